@@ -0,0 +1,42 @@
+#include "AllocationCounter.h"
+
+/* The replacements of the global allocation functions live in their own translation unit, so the compiler never inlines
+ * a replaced operator delete into a caller where it can see the matching operator new, and every form of operator new
+ * and operator delete is replaced so each block is released by the same allocator that made it */
+
+/** Number of heap allocations made through operator new, counted by the replacements below */
+static atomic<long long> numAllocations(0);
+
+void *operator new(size_t size) {
+    numAllocations++;
+    void *ptr = malloc(size > 0 ? size : 1);
+    if (ptr == NULL) {
+        throw bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+/** \brief getNumAllocations returns the number of heap allocations made through operator new so far */
+long long getNumAllocations() {
+    return numAllocations;
+} /* end getNumAllocations */
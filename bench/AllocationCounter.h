@@ -0,0 +1,6 @@
+#pragma once
+
+#include "include.h"
+
+/* getNumAllocations returns the number of heap allocations made through operator new so far, see AllocationCounter.cpp */
+long long getNumAllocations();
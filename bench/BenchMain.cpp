@@ -0,0 +1,243 @@
+// BenchMain.cpp : Defines the entry point for the lincs_bench benchmark
+//
+
+/** \brief lincs_bench runs fixed cohorts of patients through Patient::simulateWeek for a given .in file and reports
+ * the throughput of the simulation: patients per second, nanoseconds per week spent in each weekly updater, and heap
+ * allocations per patient and per attended prenatal appointment. Nothing is written to the results directory and no patients are traced, so the numbers
+ * measure the simulation itself and can be compared between builds to catch performance regressions.
+ *
+ * Usage: lincs_bench [<input file>.in] [--patients N] [--repeats R] [--leap | --batch]
+ *        lincs_bench [<input file>.in] --compare [--patients N] [--leap | --batch]
+ *        lincs_bench --micro [--draws N]
+ *
+ * Built with -DLINCS_COUNT_COPIES=ON it also reports the bytes copied per attended appointment by copies of the prenatal
+ * test structs, see src/CopyCounter.h; the counting slows the simulation, so time a build without it.
+ * With --leap the quiet weeks are skipped as in lincs --leap; weeks/patient then counts the weeks actually simulated.
+ * With --batch the cohort is run by a BatchEngine as in lincs --batch; only patients/sec and allocations are reported.
+ * With --compare nothing is timed; N patients (default 200000) are run through weekly stepping and N others through the
+ * --batch engine (or --leap if given), and the z-score of each key outcome's difference is reported, see EngineCompare.cpp.
+ * With no input file the synthetic cohort in bench/bench.in is run, so the baseline needs nothing outside the repository.
+ * With --micro no input file is read; the random number primitives are timed instead, see MicroBench.cpp.
+ *
+ * Each repeat simulates the same patients 0 to N-1 with the fixed seed, so every repeat (and every build that does not
+ * change the model) does exactly the same work. The first repeat also warms up the caches; the best repeat is reported.
+ */
+
+#include "include.h"
+#include "MicroBench.h"
+#include "AllocationCounter.h"
+#include "EngineCompare.h"
+
+/** BenchResult holds the measurements of one repeat of the benchmark cohort */
+class BenchResult {
+public:
+    /** Wall clock seconds spent simulating the cohort */
+    double elapsedSeconds;
+    /** Number of weeks simulated over all patients */
+    long long numWeeks;
+    /** Number of heap allocations made while simulating the cohort */
+    long long numAllocations;
+    /** Number of prenatal appointments attended over all patients */
+    long long numAppointments;
+    /** Number of bytes copied by copies of PrenatalTestInstance and of PrenatalTest, if LINCS_COUNT_COPIES is defined */
+    long long numTestInstanceBytesCopied;
+    long long numTestBytesCopied;
+    /** Time spent in each weekly updater */
+    Patient::UpdaterTimings updaterTimings;
+};
+
+/** \brief getNumBytesCopied returns the bytes copied so far by copies of PrenatalTestInstance and of PrenatalTest, or
+ * zeros if the build does not count them
+ *
+ * \param numTestInstanceBytesCopied the bytes copied by copies of PrenatalTestInstance
+ * \param numTestBytesCopied the bytes copied by copies of PrenatalTest
+ **/
+void getNumBytesCopied(long long &numTestInstanceBytesCopied, long long &numTestBytesCopied) {
+#ifdef LINCS_COUNT_COPIES
+    numTestInstanceBytesCopied = CountedCopies<SimContext::PrenatalTestInstance>::numBytesCopied;
+    numTestBytesCopied = CountedCopies<SimContext::PrenatalTestingInputs::PrenatalTest>::numBytesCopied;
+#else
+    numTestInstanceBytesCopied = 0;
+    numTestBytesCopied = 0;
+#endif
+} /* end getNumBytesCopied */
+
+/** \brief runBenchCohort simulates patients [0, numPatients) with one reused Patient object, the same way simulatePatients does
+ *
+ * \param simContext a pointer to the SimContext holding the inputs
+ * \param numPatients the number of patients in the cohort
+ * \param timeUpdaters if true, the time spent in each updater is recorded; this adds clock reads to every week
+ * \param benchResult the measurements of this run
+ **/
+void runBenchCohort(SimContext *simContext, int numPatients, bool timeUpdaters, BenchResult &benchResult) {
+    string runName = simContext->getRunSpecsInputs()->runName;
+    RunStats *runStats = new RunStats(runName, simContext);
+    CostStats *costStats = new CostStats(runName, simContext);
+    /** The trace file is never opened, so printTrace does nothing */
+    Tracer *tracer = new Tracer(runName, simContext, 1);
+
+    memset(&benchResult, 0, sizeof(benchResult));
+    Patient::UpdaterTimings *updaterTimings = timeUpdaters ? &benchResult.updaterTimings : NULL;
+    long long startAllocations = getNumAllocations();
+    long long startTestInstanceBytes, startTestBytes;
+    getNumBytesCopied(startTestInstanceBytes, startTestBytes);
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    if (BatchEngine::useBatchMode) {
+        BatchEngine batchEngine(simContext, runStats, costStats, tracer);
+        batchEngine.simulatePatients(0, numPatients);
+    }
+    Patient *patient = NULL;
+    for (int patientNum = 0; patientNum < numPatients && !BatchEngine::useBatchMode; patientNum++) {
+        if (patient == NULL) {
+            patient = new Patient(simContext, runStats, costStats, tracer, patientNum, false);
+        }
+        else {
+            patient->reset(patientNum, false);
+        }
+        while (!patient->getChildState()->deliveryOcurred && patient->getChildState()->isAlive) {
+            patient->simulateWeek(updaterTimings);
+            benchResult.numWeeks++;
+        }
+    }
+    delete patient;
+
+    benchResult.elapsedSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    benchResult.numAllocations = getNumAllocations() - startAllocations;
+    getNumBytesCopied(benchResult.numTestInstanceBytesCopied, benchResult.numTestBytesCopied);
+    benchResult.numTestInstanceBytesCopied -= startTestInstanceBytes;
+    benchResult.numTestBytesCopied -= startTestBytes;
+    benchResult.numAppointments = runStats->getPopulationSummary()->totalClinicVisitsPregnancy;
+
+    delete tracer;
+    delete runStats;
+    delete costStats;
+} /* end runBenchCohort */
+
+/** \brief Main function for the benchmark */
+int main(int argc, char *argv[]) {
+    /** Parse the command line: the .in file and the optional cohort size and number of repeats */
+    string inputFileArg = "";
+    int numPatients = -1;
+    int numRepeats = 3;
+    bool runMicro = false;
+    bool runCompare = false;
+    long long numDraws = 50000000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--micro") == 0) {
+            runMicro = true;
+        }
+        else if (strcmp(argv[i], "--compare") == 0) {
+            runCompare = true;
+        }
+        else if (strcmp(argv[i], "--draws") == 0 && i + 1 < argc) {
+            numDraws = atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--patients") == 0 && i + 1 < argc) {
+            numPatients = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) {
+            numRepeats = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--leap") == 0) {
+            Patient::useLeapMode = true;
+        }
+        else if (strcmp(argv[i], "--batch") == 0) {
+            BatchEngine::useBatchMode = true;
+        }
+        else if (inputFileArg.empty()) {
+            inputFileArg = argv[i];
+        }
+    }
+    if (runMicro && numDraws > 0) {
+        CmvUtil::setRandomSeedType(false);
+        runMicroBenchmarks(numDraws);
+        return 0;
+    }
+    if (inputFileArg.empty()) {
+        inputFileArg = LINCS_BENCH_INPUT;
+    }
+    if (numPatients == -1) {
+        numPatients = runCompare ? 200000 : 10000;
+    }
+    if (numPatients < 1 || numRepeats < 1) {
+        printf("Usage: lincs_bench [<input file>%s] [--patients N] [--repeats R] [--leap | --batch]\n", CmvUtil::FILE_EXTENSION_FOR_INPUT);
+        printf("       lincs_bench [<input file>%s] --compare [--patients N] [--leap | --batch]\n", CmvUtil::FILE_EXTENSION_FOR_INPUT);
+        printf("       lincs_bench --micro [--draws N]\n");
+        return 1;
+    }
+
+    /** Split the argument into the inputs directory and the run name */
+    size_t separatorPos = inputFileArg.find_last_of("\\/");
+    if (separatorPos == string::npos) {
+        CmvUtil::useCurrentDirectoryForInputs();
+    }
+    else {
+        CmvUtil::inputsDirectory = inputFileArg.substr(0, separatorPos);
+        inputFileArg = inputFileArg.substr(separatorPos + 1);
+    }
+    string runName = inputFileArg.substr(0, inputFileArg.find(CmvUtil::FILE_EXTENSION_FOR_INPUT));
+
+    SimContext *simContext = new SimContext(runName);
+    try {
+        simContext->readInputs();
+    }
+    catch (string &errorString) {
+        printf("%s\n", errorString.c_str());
+        delete simContext;
+        return 1;
+    }
+    CmvUtil::setRandomSeedType(false);
+    if (BatchEngine::useBatchMode) {
+        Patient::useLeapMode = false;
+    }
+    if (runCompare) {
+        int exitCode = runEngineComparison(simContext, numPatients);
+        delete simContext;
+        return exitCode;
+    }
+
+    printf("Benchmark: %s, %d patients, %d repeats%s\n", runName.c_str(), numPatients, numRepeats,
+        BatchEngine::useBatchMode ? ", batch mode" : (Patient::useLeapMode ? ", leap mode" : ""));
+
+    /** Throughput and allocations are measured without the updater clock reads; the best repeat is kept */
+    BenchResult benchResult = BenchResult();
+    BenchResult bestResult = BenchResult();
+    for (int repeatNum = 0; repeatNum < numRepeats; repeatNum++) {
+        runBenchCohort(simContext, numPatients, false, benchResult);
+        printf("  Repeat %d: %.3f seconds, %.0f patients/sec\n", repeatNum + 1, benchResult.elapsedSeconds,
+            numPatients / max(benchResult.elapsedSeconds, 1e-9));
+        if (repeatNum == 0 || benchResult.elapsedSeconds < bestResult.elapsedSeconds) {
+            bestResult = benchResult;
+        }
+    }
+    printf("Patients/sec: %.0f\n", numPatients / max(bestResult.elapsedSeconds, 1e-9));
+    printf("Allocations/patient: %.2f\n", (double) bestResult.numAllocations / numPatients);
+    printf("Allocations/appointment: %.3f\n", (double) bestResult.numAllocations / max(bestResult.numAppointments, 1LL));
+#ifdef LINCS_COUNT_COPIES
+    printf("Bytes copied/appointment: %.1f (PrenatalTestInstance %.1f, PrenatalTest %.1f)\n",
+        (double) (bestResult.numTestInstanceBytesCopied + bestResult.numTestBytesCopied) / max(bestResult.numAppointments, 1LL),
+        (double) bestResult.numTestInstanceBytesCopied / max(bestResult.numAppointments, 1LL),
+        (double) bestResult.numTestBytesCopied / max(bestResult.numAppointments, 1LL));
+#else
+    printf("Bytes copied/appointment: not counted, configure with -DLINCS_COUNT_COPIES=ON\n");
+#endif
+    if (BatchEngine::useBatchMode) {
+        delete simContext;
+        return 0;
+    }
+    printf("Weeks/patient: %.2f\n", (double) bestResult.numWeeks / numPatients);
+    printf("ns/week: %.1f\n", bestResult.elapsedSeconds * 1e9 / max(bestResult.numWeeks, 1LL));
+
+    /** A separate timed run splits each week's time between the updaters */
+    runBenchCohort(simContext, numPatients, true, benchResult);
+    printf("%-20s %12s %12s\n", "Updater", "ns/week", "calls");
+    for (int updaterType = 0; updaterType < Patient::NUM_UPDATER_TYPES; updaterType++) {
+        printf("%-20s %12.1f %12lld\n", Patient::UPDATER_TYPE_NAMES[updaterType],
+            (double) benchResult.updaterTimings.nanoseconds[updaterType] / max(benchResult.numWeeks, 1LL),
+            benchResult.updaterTimings.numCalls[updaterType]);
+    }
+
+    delete simContext;
+    return 0;
+} /* end main */
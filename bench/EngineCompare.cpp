@@ -0,0 +1,129 @@
+#include "EngineCompare.h"
+
+/** Outcomes whose means must agree between the engines; each is averaged over the patients of a cohort */
+enum COMPARE_OUTCOME {COMPARE_MATERNAL_CMV, COMPARE_CONGENITAL_CMV, COMPARE_MISCARRIAGE, COMPARE_ALIVE_WEEK_40,
+    COMPARE_TESTS_PER_PREGNANCY, NUM_COMPARE_OUTCOMES};
+static const char *COMPARE_OUTCOME_NAMES[NUM_COMPARE_OUTCOMES] = {"Maternal CMV Infection", "Congenital CMV Infection",
+    "Miscarriage/Stillbirth", "Alive at Week 40", "Prenatal Tests per Pregnancy"};
+/** Week whose number of alive fetuses is compared */
+static const int COMPARE_WEEK = 40;
+/** Largest |z| accepted for any outcome; with five outcomes a correct engine exceeds it in about 1 run in 3000 */
+static const double MAX_ABS_Z = 4.0;
+
+/** \brief runEngineCohort simulates patients [firstPatient, lastPatient) with the engine selected by BatchEngine::useBatchMode
+ * and Patient::useLeapMode, the same way simulatePatients does, and returns the RunStats they accumulated
+ *
+ * \param simContext a pointer to the SimContext holding the inputs
+ * \param firstPatient the number of the first patient to simulate
+ * \param lastPatient one past the number of the last patient to simulate
+ **/
+static RunStats *runEngineCohort(SimContext *simContext, int firstPatient, int lastPatient) {
+    string runName = simContext->getRunSpecsInputs()->runName;
+    RunStats *runStats = new RunStats(runName, simContext);
+    CostStats *costStats = new CostStats(runName, simContext);
+    /** The trace file is never opened, so printTrace does nothing */
+    Tracer *tracer = new Tracer(runName, simContext, 1);
+
+    if (BatchEngine::useBatchMode) {
+        BatchEngine batchEngine(simContext, runStats, costStats, tracer);
+        batchEngine.simulatePatients(firstPatient, lastPatient);
+    }
+    else {
+        Patient *patient = new Patient(simContext, runStats, costStats, tracer, firstPatient, false);
+        for (int patientNum = firstPatient; patientNum < lastPatient; patientNum++) {
+            if (patientNum > firstPatient) {
+                patient->reset(patientNum, false);
+            }
+            while (!patient->getChildState()->deliveryOcurred && patient->getChildState()->isAlive) {
+                patient->simulateWeek();
+            }
+        }
+        delete patient;
+    }
+
+    delete tracer;
+    delete costStats;
+    return runStats;
+} /* end runEngineCohort */
+
+/** \brief getOutcome returns the mean of an outcome over the patients of a cohort and the standard error of that mean
+ *
+ * \param runStats a pointer to the RunStats of the cohort
+ * \param numPatients the number of patients in the cohort
+ * \param outcome the COMPARE_OUTCOME to return
+ * \param mean the mean of the outcome per patient
+ * \param stdError the standard error of mean
+ **/
+static void getOutcome(RunStats *runStats, int numPatients, int outcome, double &mean, double &stdError) {
+    const RunStats::PrecisionSummary *precision = runStats->getPrecisionSummary();
+    double stdDev = 0;
+    double halfWidth = 0;
+    switch (outcome) {
+    case COMPARE_MATERNAL_CMV:
+        RunStats::getPrecision(*precision, RunStats::PRECISION_MATERNAL_CMV, mean, stdDev, halfWidth);
+        break;
+    case COMPARE_CONGENITAL_CMV:
+        RunStats::getPrecision(*precision, RunStats::PRECISION_CONGENITAL_CMV, mean, stdDev, halfWidth);
+        break;
+    case COMPARE_TESTS_PER_PREGNANCY:
+        RunStats::getPrecision(*precision, RunStats::PRECISION_TESTS_PER_PREGNANCY, mean, stdDev, halfWidth);
+        break;
+    case COMPARE_MISCARRIAGE:
+        /* At most one fetal death per patient, so the outcome is a proportion */
+        mean = (double) runStats->getChildDeathStats()->fetalDeaths / numPatients;
+        stdDev = sqrt(mean * (1 - mean));
+        break;
+    case COMPARE_ALIVE_WEEK_40: {
+        /* Each patient is counted at most once in a week's alive fetuses */
+        const RunStats::PrenatalTimeSummary *weekSummary = runStats->getPrenatalTimeSummary(COMPARE_WEEK);
+        mean = weekSummary != NULL ? (double) weekSummary->numAliveFetuses / numPatients : 0.0;
+        stdDev = sqrt(mean * (1 - mean));
+        break;
+    }
+    }
+    stdError = stdDev / sqrt((double) numPatients);
+} /* end getOutcome */
+
+/** \brief runEngineComparison checks that the --batch (or, if selected, --leap) engine is statistically equivalent to
+ * weekly stepping. Weekly stepping simulates patients [0, N) and the engine under test patients [N, 2N), so the two
+ * cohorts draw from disjoint random streams and are independent samples. For each key outcome the difference of the
+ * means is divided by its standard error; under equivalence each z-score is approximately standard normal.
+ *
+ * \param simContext a pointer to the SimContext holding the inputs
+ * \param numPatients the number of patients N simulated by each engine
+ * \return 0 if every |z| is at most MAX_ABS_Z, 1 otherwise
+ **/
+int runEngineComparison(SimContext *simContext, int numPatients) {
+    bool testBatch = BatchEngine::useBatchMode || !Patient::useLeapMode;
+    const char *engineName = testBatch ? "batch" : "leap";
+
+    BatchEngine::useBatchMode = false;
+    Patient::useLeapMode = false;
+    RunStats *referenceStats = runEngineCohort(simContext, 0, numPatients);
+    BatchEngine::useBatchMode = testBatch;
+    Patient::useLeapMode = !testBatch;
+    RunStats *engineStats = runEngineCohort(simContext, numPatients, 2 * numPatients);
+
+    printf("Engine comparison: %s, %d patients per engine, weekly (patients 0 to %d) vs %s (patients %d to %d)\n",
+        simContext->getRunSpecsInputs()->runName.c_str(), numPatients, numPatients - 1, engineName, numPatients, 2 * numPatients - 1);
+    printf("%-30s %12s %12s %12s %8s\n", "Outcome", "Weekly", engineName, "Difference", "z");
+    int numFailed = 0;
+    for (int outcome = 0; outcome < NUM_COMPARE_OUTCOMES; outcome++) {
+        double referenceMean, referenceError, engineMean, engineError;
+        getOutcome(referenceStats, numPatients, outcome, referenceMean, referenceError);
+        getOutcome(engineStats, numPatients, outcome, engineMean, engineError);
+        double stdError = sqrt(referenceError * referenceError + engineError * engineError);
+        double z = stdError > 0 ? (engineMean - referenceMean) / stdError : 0.0;
+        bool failed = fabs(z) > MAX_ABS_Z;
+        if (failed) {
+            numFailed++;
+        }
+        printf("%-30s %12.6f %12.6f %12.6f %8.2f%s\n", COMPARE_OUTCOME_NAMES[outcome], referenceMean, engineMean,
+            engineMean - referenceMean, z, failed ? "  FAIL" : "");
+    }
+    printf("%s\n", numFailed == 0 ? "Engines agree: every |z| is at most 4" : "Engines DISAGREE: some |z| exceeds 4");
+
+    delete referenceStats;
+    delete engineStats;
+    return numFailed == 0 ? 0 : 1;
+} /* end runEngineComparison */
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "include.h"
+
+/* runEngineComparison checks the --batch or --leap engine against weekly stepping, see EngineCompare.cpp */
+int runEngineComparison(SimContext *simContext, int numPatients);
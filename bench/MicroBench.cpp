@@ -0,0 +1,136 @@
+#include "MicroBench.h"
+
+/** \brief getPolarGaussian is the polar Box-Muller sampler CmvUtil::getRandomGaussian used before the ziggurat,
+ * kept here as the baseline: it draws pairs of uniforms until one lands in the unit circle and discards half the pair
+ **/
+static double getPolarGaussian(double mean, double stdDev) {
+    double x1, x2, w;
+    do {
+        x1 = 2.0 * CmvUtil::rng() - 1.0;
+        x2 = 2.0 * CmvUtil::rng() - 1.0;
+        w = x1 * x1 + x2 * x2;
+    } while (w >= 1.0);
+    w = sqrt((-2.0 * log(w)) / w);
+    return mean + (x2 * w * stdDev);
+} /* end getPolarGaussian */
+
+/** \brief getRejectionTiming is how the Patient constructor drew its biology timings before getRandomTruncatedGaussian,
+ * kept here as the baseline: it redraws the rounded normal until it is non-negative
+ **/
+static double getRejectionTiming(double mean, double stdDev) {
+    int weeks = -1;
+    while (weeks < 0) {
+        weeks = (int)(CmvUtil::getRandomGaussian(mean, stdDev) + 0.5);
+    }
+    return weeks;
+} /* end getRejectionTiming */
+
+/** \brief getVectorRandomInt is the original CmvUtil::getRandomInt, kept here as the baseline: it builds a vector of equal
+ * weights over the range on every call and walks it with selectFromDist
+ **/
+static int getVectorRandomInt(int min, int max) {
+    vector<double> integerVect(max - min, 1 / ((double) max - (double) min));
+    return CmvUtil::selectFromDist(integerVect, CmvUtil::rng()) + min;
+} /* end getVectorRandomInt */
+
+/** \brief getScaledRandomInt scales a uniform double to the range, as getRandomInt did before Lemire's method; slightly
+ * biased toward some values when the range does not divide 2^32
+ **/
+static int getScaledRandomInt(int min, int max) {
+    return min + (int) (CmvUtil::rng() * ((double) max - (double) min));
+} /* end getScaledRandomInt */
+
+/** \brief timeDraws calls drawFunction numDraws times and prints the draws per second; the sum of the draws is printed
+ * so the compiler cannot drop the calls
+ *
+ * \param name the name printed for this benchmark
+ * \param numDraws the number of draws to time
+ * \param drawFunction returns one draw
+ **/
+template <class DrawFunction>
+static void timeDraws(const char *name, long long numDraws, DrawFunction drawFunction) {
+    CmvUtil::rng.seed(CmvUtil::randomSeed, 0);
+    double sumDraws = 0;
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+    for (long long i = 0; i < numDraws; i++) {
+        sumDraws += drawFunction();
+    }
+    double elapsedSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    printf("%-38s %12.0f draws/sec %10.2f ns/draw   (sum %g)\n", name, numDraws / max(elapsedSeconds, 1e-9),
+        elapsedSeconds * 1e9 / numDraws, sumDraws);
+} /* end timeDraws */
+
+/** \brief timeBatchedDraws is timeDraws for primitives that make many draws per call: batchFunction fills a buffer of
+ * BATCH_DRAWS draws and returns their sum, and is called until numDraws draws have been made
+ *
+ * \param name the name printed for this benchmark
+ * \param numDraws the number of draws to time
+ * \param batchFunction makes BATCH_DRAWS draws into the buffer it is given and returns their sum
+ **/
+template <class BatchFunction>
+static void timeBatchedDraws(const char *name, long long numDraws, BatchFunction batchFunction) {
+    const int BATCH_DRAWS = 1024;
+    CmvUtil::rng.seed(CmvUtil::randomSeed, 0);
+    double sumDraws = 0;
+    long long numBatches = max(numDraws / BATCH_DRAWS, 1LL);
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+    for (long long i = 0; i < numBatches; i++) {
+        sumDraws += batchFunction(BATCH_DRAWS);
+    }
+    double elapsedSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    numDraws = numBatches * BATCH_DRAWS;
+    printf("%-38s %12.0f draws/sec %10.2f ns/draw   (sum %g)\n", name, numDraws / max(elapsedSeconds, 1e-9),
+        elapsedSeconds * 1e9 / numDraws, sumDraws);
+} /* end timeBatchedDraws */
+
+/** \brief runMicroBenchmarks times the random number primitives in CmvUtil on this thread's generator
+ * \param numDraws the number of draws to time for each primitive
+ **/
+void runMicroBenchmarks(long long numDraws) {
+    printf("Micro benchmarks: %lld draws each\n", numDraws);
+    timeDraws("getRandomDouble", numDraws, []() { return CmvUtil::getRandomDouble(); });
+    /* The same uniforms a batch at a time, and Bernoulli rolls against a spread of probabilities one by one and batched */
+    static double uniforms[1024], probs[1024];
+    static bool results[1024];
+    for (int i = 0; i < 1024; i++) {
+        probs[i] = (i + 0.5) / 1024;
+    }
+    timeBatchedDraws("fillUniforms", numDraws, [](int n) {
+        CmvUtil::fillUniforms(uniforms, n);
+        double sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += uniforms[i];
+        }
+        return sum;
+    });
+    timeBatchedDraws("rollBasedOnOdds", numDraws, [](int n) {
+        double sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += CmvUtil::rollBasedOnOdds(probs[i]);
+        }
+        return sum;
+    });
+    timeBatchedDraws("rollBatch", numDraws, [](int n) {
+        CmvUtil::rollBatch(probs, results, n);
+        double sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += results[i];
+        }
+        return sum;
+    });
+    timeDraws("polar Box-Muller (baseline)", numDraws, []() { return getPolarGaussian(10.0, 3.0); });
+    timeDraws("getRandomGaussian", numDraws, []() { return CmvUtil::getRandomGaussian(10.0, 3.0); });
+    /* A timing whose mean is small relative to its standard deviation, where the rejection loop redraws most often */
+    timeDraws("timing by rejection (baseline)", numDraws, []() { return getRejectionTiming(1.0, 3.0); });
+    timeDraws("timing by getRandomTruncatedGaussian", numDraws,
+        []() { return (double) max((int)(CmvUtil::getRandomTruncatedGaussian(1.0, 3.0, -1.5) + 0.5), 0); });
+    /* Bounded integers over a small range, as used for the weeks since the last CMV infection, and a large range; the
+     * vector baseline is linear in the range size, so it gets fewer draws over the large range */
+    timeDraws("int [0, 12) by vector (baseline)", numDraws, []() { return (double) getVectorRandomInt(0, 12); });
+    timeDraws("int [0, 12) by scaled double", numDraws, []() { return (double) getScaledRandomInt(0, 12); });
+    timeDraws("int [0, 12) by getRandomInt", numDraws, []() { return (double) CmvUtil::getRandomInt(0, 12); });
+    timeDraws("int [0, 1e5) by vector (baseline)", max(numDraws / 10000, 1LL), []() { return (double) getVectorRandomInt(0, 100000); });
+    timeDraws("int [0, 1e5) by scaled double", numDraws, []() { return (double) getScaledRandomInt(0, 100000); });
+    timeDraws("int [0, 1e5) by getRandomInt", numDraws, []() { return (double) CmvUtil::getRandomInt(0, 100000); });
+    timeDraws("int [0, 2^31 - 1) by getRandomInt", numDraws, []() { return (double) CmvUtil::getRandomInt(0, INT_MAX); });
+} /* end runMicroBenchmarks */
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "include.h"
+
+/* runMicroBenchmarks times the random number primitives in CmvUtil, see MicroBench.cpp */
+void runMicroBenchmarks(long long numDraws);
@@ -0,0 +1,153 @@
+#include "include.h"
+
+/** Batch mode is off unless the --batch command line option is given */
+bool BatchEngine::useBatchMode = false;
+
+/** \brief Constructor takes in the simulation context, run stats, cost stats and tracer the patients are simulated with, and
+ * tabulates the probability of the end of pregnancy by age and week for the quiet-week rolls */
+BatchEngine::BatchEngine(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer) :
+        simContext(simContext),
+        runStats(runStats),
+        costStats(costStats),
+        tracer(tracer),
+        patients(BATCH_SIZE, (Patient *) NULL),
+        randomStates(BATCH_SIZE),
+        quietWeekRolls(SimContext::MAX_WEEKS_PREGNANT * BATCH_SIZE, 0),
+        isActive(BATCH_SIZE, 0),
+        quietWeeksEnd(BATCH_SIZE, 0),
+        probMaternalCMV(BATCH_SIZE, 0),
+        probMildIllness(BATCH_SIZE, 0),
+        maternalAgeYearsExact(BATCH_SIZE, 0),
+        maternalAgeYears(BATCH_SIZE, 0),
+        probNoEvent(BATCH_SIZE, 0),
+        hasEvent(BATCH_SIZE, 0)
+{
+    probPregnancyEnds.resize(SimContext::AGE_YEARS * SimContext::MAX_WEEKS_PREGNANT);
+    for (int age = 0; age < SimContext::AGE_YEARS; age++) {
+        for (int week = 0; week < SimContext::MAX_WEEKS_PREGNANT; week++) {
+            probPregnancyEnds[age * SimContext::MAX_WEEKS_PREGNANT + week] = PregnancyUpdater::getProbPregnancyEnds(simContext, age, week);
+        }
+    }
+} /* end Constructor */
+
+/** \brief Destructor deletes the Patient objects of the lanes */
+BatchEngine::~BatchEngine(void) {
+    for (int lane = 0; lane < BATCH_SIZE; lane++) {
+        delete patients[lane];
+    }
+} /* end Destructor */
+
+/** \brief simulatePatients runs the patients numbered [firstPatient, lastPatient) through their pregnancies, BATCH_SIZE of
+ * them at a time, accumulating into the run stats and cost stats given to the constructor. Each patient still draws its own
+ * random numbers keyed by its patient number, so the results do not depend on the batches or threads the range is split into.
+ *
+ * \param firstPatient the number of the first patient to simulate
+ * \param lastPatient one past the number of the last patient to simulate
+*/
+void BatchEngine::simulatePatients(int firstPatient, int lastPatient) {
+    for (int batchStart = firstPatient; batchStart < lastPatient; batchStart += BATCH_SIZE) {
+        int numLanes = min(BATCH_SIZE, lastPatient - batchStart);
+        for (int lane = 0; lane < numLanes; lane++) {
+            startLane(lane, batchStart + lane);
+        }
+        simulateBatch(numLanes);
+    }
+} /* end simulatePatients */
+
+/** \brief startLane initializes a new patient in the given lane, draws its quiet-week rolls and saves its random number
+ * generators
+ *
+ * \param lane the lane to use
+ * \param patientNum the number of the patient
+*/
+void BatchEngine::startLane(int lane, int patientNum) {
+    if (patients[lane] == NULL) {
+        patients[lane] = new Patient(simContext, runStats, costStats, tracer, patientNum, false);
+    }
+    else {
+        patients[lane]->reset(patientNum, false);
+    }
+    PhiloxRand quietWeekRng = CmvUtil::rng;
+    quietWeekRng.setStream(CmvUtil::STREAM_BATCH_QUIET_WEEKS);
+    double rolls[SimContext::MAX_WEEKS_PREGNANT];
+    quietWeekRng.fillUniforms(rolls, SimContext::MAX_WEEKS_PREGNANT);
+    for (int week = 0; week < SimContext::MAX_WEEKS_PREGNANT; week++) {
+        quietWeekRolls[week * BATCH_SIZE + lane] = rolls[week];
+    }
+    CmvUtil::saveRandomState(randomStates[lane]);
+    isActive[lane] = 1;
+    updateLane(lane);
+} /* end startLane */
+
+/** \brief updateLane reloads a lane's state from its patient after the patient is initialized or simulates a week: whether
+ * the pregnancy is over, how many quiet weeks lie ahead, and for those weeks the probabilities of the rolls and the age
+ *
+ * \param lane the lane to update
+*/
+void BatchEngine::updateLane(int lane) {
+    Patient *patient = patients[lane];
+    if (patient->childState.deliveryOcurred || !patient->childState.isAlive) {
+        isActive[lane] = 0;
+        return;
+    }
+    quietWeeksEnd[lane] = patient->getQuietWeeksEnd();
+    if (quietWeeksEnd[lane] > patient->generalState.weekNum) {
+        patient->cmvInfectionUpdater.getQuietWeekProbs(probMaternalCMV[lane], probMildIllness[lane]);
+        maternalAgeYearsExact[lane] = patient->maternalState.maternalAgeYearsExact;
+        maternalAgeYears[lane] = patient->maternalState.maternalAgeYears;
+    }
+} /* end updateLane */
+
+/** \brief simulateBatch advances the patients in lanes [0, numLanes) a week at a time until every pregnancy is over
+ *
+ * Each week, every quiet lane checks its roll for the week against the probability that none of maternal infection, mild illness
+ * and the end of pregnancy happens, and if none does the lane just ages a week; its patient catches up on the skipped
+ * weeks, crediting them to the weekly statistics, when it next has something to do. Every other lane, and every lane
+ * whose rolls fired, is simulated for the week through the updaters, with the fired rolls preset as in
+ * Patient::leapQuietWeeks so that they are conditioned on at least one event.
+ *
+ * \param numLanes the number of lanes in use
+*/
+void BatchEngine::simulateBatch(int numLanes) {
+    const double *probEnds = probPregnancyEnds.data();
+    for (int week = 0; week < SimContext::MAX_WEEKS_PREGNANT; week++) {
+        /* Rolls of the quiet lanes */
+        const double *rolls = quietWeekRolls.data() + week * BATCH_SIZE;
+        for (int lane = 0; lane < numLanes; lane++) {
+            double probEndsThisWeek = probEnds[maternalAgeYears[lane] * SimContext::MAX_WEEKS_PREGNANT + week];
+            probNoEvent[lane] = (1 - probMaternalCMV[lane]) * (1 - probMildIllness[lane]) * (1 - probEndsThisWeek);
+            hasEvent[lane] = rolls[lane] >= probNoEvent[lane];
+        }
+        for (int lane = 0; lane < numLanes; lane++) {
+            bool staysQuiet = isActive[lane] && week < quietWeeksEnd[lane] && !hasEvent[lane];
+            maternalAgeYearsExact[lane] = maternalAgeYearsExact[lane] + (staysQuiet ? (double)1/52 : 0);
+            maternalAgeYears[lane] = (int)(maternalAgeYearsExact[lane] + 0.5);
+        }
+
+        /* Lanes with something to do this week */
+        int numActive = 0;
+        for (int lane = 0; lane < numLanes; lane++) {
+            if (!isActive[lane]) {
+                continue;
+            }
+            numActive++;
+            bool isQuiet = week < quietWeeksEnd[lane];
+            if (isQuiet && !hasEvent[lane]) {
+                continue;
+            }
+            Patient *patient = patients[lane];
+            CmvUtil::restoreRandomState(randomStates[lane]);
+            patient->skipQuietWeeks(week);
+            if (isQuiet) {
+                double probEndsThisWeek = probEnds[maternalAgeYears[lane] * SimContext::MAX_WEEKS_PREGNANT + week];
+                patient->presetEventWeekRolls(probMaternalCMV[lane], probMildIllness[lane], probEndsThisWeek);
+            }
+            patient->simulateWeek();
+            CmvUtil::saveRandomState(randomStates[lane]);
+            updateLane(lane);
+        }
+        if (numActive == 0) {
+            break;
+        }
+    }
+} /* end simulateBatch */
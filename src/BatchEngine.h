@@ -0,0 +1,74 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The BatchEngine class simulates a range of patients a batch at a time, advancing every patient of the batch by one week
+ * before any patient moves on to the next week. A patient in a run of quiet weeks (see Patient::isQuietWeek) is held in
+ * the lane arrays below, one entry per patient of the batch: each week the rolls for maternal infection, mild illness and
+ * the end of pregnancy of all quiet lanes are made in tight loops over those arrays, with no calls into the updaters, and the
+ * uniforms for those rolls are drawn for the whole pregnancy when the patient starts, with PhiloxRand::fillUniforms.
+ * A lane with anything else to do that week, or whose rolls fire, is stepped through the weekly updaters by
+ * Patient::simulateWeek exactly as in the per-patient engine, which remains the reference implementation.
+ *
+ * Results are statistically equivalent to the per-patient engine but not identical to it, since the quiet-week rolls come
+ * from their own random number stream. Traced patients and antithetic pairs are always left to the per-patient engine.
+*/
+class BatchEngine
+{
+public:
+    /* Constructor and Destructor */
+    BatchEngine(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer);
+    ~BatchEngine(void);
+
+    /* simulatePatients runs the patients numbered [firstPatient, lastPatient) through their pregnancies */
+    void simulatePatients(int firstPatient, int lastPatient);
+
+    /** If true, cohorts are simulated batch by batch with a BatchEngine; set by the --batch command line option */
+    static bool useBatchMode;
+    /** Number of patients advanced week by week together */
+    static const int BATCH_SIZE = 64;
+
+private:
+    /** Pointer to the simulation context (i.e. .in file information) */
+    SimContext *simContext;
+    /** Pointer to the run stats object (or per-thread shard) the patients accumulate into */
+    RunStats *runStats;
+    /** Pointer to the cost stats object (or per-thread shard) the patients accumulate into */
+    CostStats *costStats;
+    /** Pointer to the tracer */
+    Tracer *tracer;
+    /** Probability that the pregnancy of a mother without active CMV ends, indexed by [age in years * MAX_WEEKS_PREGNANT + week] */
+    vector<double> probPregnancyEnds;
+
+    /** The Patient object of each lane, created for the first batch and reset for the later ones */
+    vector<Patient *> patients;
+    /** Random number generators of each lane's patient, kept while the other lanes are simulated */
+    vector<CmvUtil::RandomState> randomStates;
+    /** Each lane's quiet-week roll for every week, indexed by [week * BATCH_SIZE + lane]; drawn when the lane starts from
+     * stream STREAM_BATCH_QUIET_WEEKS of the patient's key, the roll for a week being the same whatever weeks are quiet */
+    vector<double> quietWeekRolls;
+
+    /* Lane state, one entry per lane; the probabilities and ages are only kept up to date while the lane is quiet */
+    /** Whether the lane's pregnancy is still going on */
+    vector<unsigned char> isActive;
+    /** The first week that is not quiet for the lane; the lane is quiet in every week before it */
+    vector<int> quietWeeksEnd;
+    /** Weekly probability of maternal infection */
+    vector<double> probMaternalCMV;
+    /** Weekly probability of mild illness */
+    vector<double> probMildIllness;
+    /** Mother's exact age in years, advanced as StateUpdater::incrementWeek does */
+    vector<double> maternalAgeYearsExact;
+    /** Mother's age in whole years */
+    vector<int> maternalAgeYears;
+    /** Probability that none of this week's rolls fires */
+    vector<double> probNoEvent;
+    /** Whether one of this week's rolls fired */
+    vector<unsigned char> hasEvent;
+
+    /* Functions for running a batch */
+    void startLane(int lane, int patientNum);
+    void updateLane(int lane);
+    void simulateBatch(int numLanes);
+};
@@ -62,8 +62,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
             if (patient->getGeneralState()->onTreatment){
                 probMaternalCMV = probMaternalCMV * simContext->getPrenatalTreatmentInputs()->PrenatalTreatmentsVector[patient->getGeneralState()->mostRecentTreatmentNumber].reductionOfWeeklySecondaryCMV;
             }            
-            randNum = CmvUtil::getRandomDouble();
-            if (randNum < probMaternalCMV) {
+            if (rollMaternalInfection(probMaternalCMV)) {
                 if (patient->getGeneralState()->tracingEnabled) {
                     tracer->printTrace(1, "Secondary Maternal CMV Infection. \n");
                     
@@ -80,7 +79,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                 setActiveCMV(true);
                 incrementNumMaternalSecondaryInfectionInTrimester(trimester);
                 /** Rolling for whether mother has symptoms */
-                randNum = CmvUtil::getRandomDouble();
+                randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_MATERNAL_SYMPTOMS);
                 probMaternalSymptomatic = simContext->getCohortInputs()->probSymptomsWithSecondaryCMV[trimester];
                 // if on treatment, apply multiplier for probability that mother is symptomatic
                 if (patient->getGeneralState()->onTreatment) {
@@ -92,7 +91,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                         tracer->printTrace(1, "Mother's CMV case is symptomatic. \n");
                     }
                     // Roll for attending appointment triggered by symptomatic CMV -- think about generalizing this so we can use for symptomatic CMV, mild illness, and known exposure (in the future)
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_ATTENDANCE);
                     if (randNum < simContext->getBackgroundScreeningInputs()->seekingHealthcareSymptomatic) {
                         // patient attends appointment
                         // ADD NUMBER OF SYMPTOMATIC TRIGGERED APPOINTMENTS TO RUNSTATS, SEPARATE FROM NUMBER OF MILD ILLNESS TRIGGERED TESTS
@@ -103,7 +102,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     // MOVE THIS TO PRENATAL TESTING UPDATER
                     // Roll for special case triggered test (special case is symptomatic maternal CMV)
                     for (int pnTest = 0; pnTest < SimContext::NUM_PRENATAL_TESTS; pnTest++) {
-                        randNum = CmvUtil::getRandomDouble();
+                        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_TRIGGER);
                         if ( randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[pnTest].symptomaticCMVTrigger) {
                             int confirmatoryNumber = SimContext::PN_NOT_CONF;
                             int testType = 0;//SimContext::PN_TEST_SPECIAL;
@@ -115,7 +114,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                             int weekToTest = patient->getGeneralState()->weekNum; // will take place the same week as the special event
                             bool testPerformed = false;
                             bool returnToPatient = false;
-                            randNum = CmvUtil::getRandomDouble();
+                            randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
                             if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[pnTest].probResultReturn) {
                                 returnToPatient = true;
                             }
@@ -133,7 +132,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                 }
                 
                 /** Rolling for whether mother knows about infection */
-                randNum = CmvUtil::getRandomDouble();
+                randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_MATERNAL_SYMPTOMS);
                 if (randNum < simContext->getPrenatalNatHistInputs()->weeklyProbKnownInfection) {
                     setKnownCMV(true);
                     setKnownHadCMV(true);
@@ -155,9 +154,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
             if (patient->getGeneralState()->onTreatment) {
                 probMaternalCMV = probMaternalCMV * simContext->getPrenatalTreatmentInputs()->PrenatalTreatmentsVector[patient->getGeneralState()->mostRecentTreatmentNumber].reductionOfWeeklyPrimaryCMV;
             }
-            randNum = CmvUtil::getRandomDouble();
-
-            if (randNum < probMaternalCMV) {
+            if (rollMaternalInfection(probMaternalCMV)) {
                 if (patient->getGeneralState()->tracingEnabled) {
                     tracer->printTrace(1, "Primary Maternal CMV Infection. \n");
                 }
@@ -176,7 +173,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                 incrementMaternalCMVinfections();
                 incrementNumMaternalPrimaryInfectionInTrimester(trimester);
                 /** Rolling for whether mother has symptoms */
-                randNum = CmvUtil::getRandomDouble();
+                randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_MATERNAL_SYMPTOMS);
                 probMaternalSymptomatic = simContext->getCohortInputs()->probSymptomsWithPrimaryCMV[trimester];
                 // if on treatment, apply multiplier for probability that mother is symptomatic
                 if (patient->getGeneralState()->onTreatment) {
@@ -189,7 +186,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     }
                 }
                 /** Rolling for whether mother knows about infection */
-                randNum = CmvUtil::getRandomDouble();
+                randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_MATERNAL_SYMPTOMS);
                 if (randNum < simContext->getPrenatalNatHistInputs()->weeklyProbKnownInfection) {
                     //incrementMaternalNumDiagnosedCMV();
                     setKnownCMV(true);
@@ -218,7 +215,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
     if (patient->getMaternalDiseaseState()->hadCMVDuringSim && week - patient->getMaternalDiseaseState()->weekOfMaternalCMVInfection == simContext->getPrenatalNatHistInputs()->maternalInfectionToVerticalTransmissionDelay) {
         if (!patient->getMaternalDiseaseState()->verticalTransmission) {
             /* rolling for vertical transmission from secondary maternal infection */
-            randNum = CmvUtil::getRandomDouble();
+            randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_VERTICAL_TRANSMISSION);
             probVerticalTransmission = simContext->getPrenatalNatHistInputs()->primaryVerticalTransmission[trimester];
             if (patient->getMaternalDiseaseState()->primaryOrSecondary == SimContext::SECONDARY) {
                 probVerticalTransmission = simContext->getPrenatalNatHistInputs()->secondaryVerticalTransmission[trimester];
@@ -238,12 +235,9 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     setChildCMVPrimaryOrSecondary(SimContext::TRUE_PRIMARY);
                     incrementVerticalTransmissionsPrimaryOrSecondary(SimContext::TRUE_PRIMARY);
                     incrementPrimaryVTByTrimester(trimester);
-                    vector<double> childPhenotypeProbs;
-                    for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
-                        childPhenotypeProbs.push_back(simContext->getCohortInputs()->probPhenotypesUponVT[SimContext::TRUE_PRIMARY][trimester][i]);
-                    }
-                    randNum = CmvUtil::getRandomDouble();
-                    int phenotype = CmvUtil::selectFromDist(childPhenotypeProbs, randNum);
+                    const DiscreteDist &childPhenotypeDist = simContext->getCohortInputs()->phenotypesUponVTDist[SimContext::TRUE_PRIMARY][trimester];
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_CHILD_PHENOTYPE);
+                    int phenotype = childPhenotypeDist.sample(randNum);
                     setPhenotypeCMV(phenotype);
                     
                     if (patient->getGeneralState()->tracingEnabled) {
@@ -255,12 +249,9 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     setChildCMVPrimaryOrSecondary(SimContext::TRUE_SECONDARY);
                     incrementVerticalTransmissionsPrimaryOrSecondary(SimContext::TRUE_SECONDARY);
                     incrementSecondaryVTByTrimester(trimester);
-                    vector<double> childPhenotypeProbs;
-                    for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
-                        childPhenotypeProbs.push_back(simContext->getCohortInputs()->probPhenotypesUponVT[SimContext::TRUE_SECONDARY][trimester][i]);
-                    }
-                    randNum = CmvUtil::getRandomDouble();
-                    int phenotype = CmvUtil::selectFromDist(childPhenotypeProbs, randNum);
+                    const DiscreteDist &childPhenotypeDist = simContext->getCohortInputs()->phenotypesUponVTDist[SimContext::TRUE_SECONDARY][trimester];
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_CHILD_PHENOTYPE);
+                    int phenotype = childPhenotypeDist.sample(randNum);
                     setPhenotypeCMV(phenotype);
                     if (patient->getGeneralState()->tracingEnabled) {
                         tracer->printTrace(1, "Secondary vertical transmission occurred. Child infected with phenotype %d. Child infection will be detectable in %d weeks.\n", patient->getChildDiseaseState()->phenotypeCMV + 1, simContext->getPrenatalNatHistInputs()->verticalTransmissionToDetectableDelay);
@@ -316,7 +307,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     }
                 }
                 bool verticalTransmission = false;
-                randNum = CmvUtil::getRandomDouble();
+                randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_VERTICAL_TRANSMISSION);
                 if (randNum < simContext->getCohortInputs()->oneTimeVerticalTransmissionProb[patient->getMaternalDiseaseState()->prevCMVPrimaryOrSecondary][patient->getMaternalDiseaseState()->prevCMVStratum]) {
                     verticalTransmission = true;
                 }
@@ -329,13 +320,9 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     else if (patient->getMaternalDiseaseState()->prevCMVPrimaryOrSecondary == SimContext::SECONDARY) {
                         incrementSecondaryVTByTrimester(trimester);
                     }
-                    vector<double> childPhenotypeProbs;
-                    for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
-                        childPhenotypeProbs.push_back(simContext->getCohortInputs()->probPhenotypesUponVT[patient->getMaternalDiseaseState()->prevCMVPrimaryOrSecondary][SimContext::PRECONCEPTION][i]);
-                    }
-
-                    randNum = CmvUtil::getRandomDouble();
-                    int phenotype = CmvUtil::selectFromDist(childPhenotypeProbs, randNum);
+                    const DiscreteDist &childPhenotypeDist = simContext->getCohortInputs()->phenotypesUponVTDist[patient->getMaternalDiseaseState()->prevCMVPrimaryOrSecondary][SimContext::PRECONCEPTION];
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_CHILD_PHENOTYPE);
+                    int phenotype = childPhenotypeDist.sample(randNum);
                     setPhenotypeCMV(phenotype);
                     setChildHadCMV(true);
                     setChildInfectedCMV(true);
@@ -367,7 +354,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
     /** Rolling for Mild Illness */
     
     if (!patient->getMaternalDiseaseState()->mildIllness) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = getLeapRollRandomDouble(Patient::LEAP_ROLL_MILD_ILLNESS, CmvUtil::STREAM_MATERNAL_SYMPTOMS);
         if (randNum < simContext->getPrenatalNatHistInputs()->weeklyProbMildIllness) {
             setMildIllness(true);
             /** If patient's first time having mild illness, increment the number of mothers who have had mild illness */
@@ -384,7 +371,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
 
             // Roll for special case triggered test (special case is symptomatic maternal CMV)
             for (int pnTest = 0; pnTest < SimContext::NUM_PRENATAL_TESTS; pnTest++) {
-                randNum = CmvUtil::getRandomDouble();
+                randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_TRIGGER);
                 if ( randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[pnTest].mildIllnessTrigger) {
                     int confirmatoryNumber = SimContext::PN_NOT_CONF;
                     int testType = 0;//SimContext::PN_TEST_SPECIAL;
@@ -396,7 +383,7 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
                     int weekToTest = patient->getGeneralState()->weekNum; // will take place the same week as the special event
                     bool testPerformed = false;
                     bool returnToPatient = false;
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
                     if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[pnTest].probResultReturn) {
                         returnToPatient = true;
                     }
@@ -424,6 +411,34 @@ void CMVInfectionUpdater::performWeeklyUpdates() {
 
 }
 
+/** \brief getQuietWeekProbs returns the probabilities of this week's maternal infection and mild illness rolls for a
+ * mother who is not infected, not ill and not on treatment, as performWeeklyUpdates would roll them
+ *
+ * \param probMaternalCMV set to the weekly probability of primary or, if the mother has had CMV, secondary infection
+ * \param probMildIllness set to the weekly probability of mild illness
+*/
+void CMVInfectionUpdater::getQuietWeekProbs(double &probMaternalCMV, double &probMildIllness) {
+    if (patient->getMaternalDiseaseState()->prevCMVCase || patient->getMaternalDiseaseState()->hadCMV) {
+        probMaternalCMV = simContext->getPrenatalNatHistInputs()->weeklySecondaryCMV;
+    }
+    else {
+        probMaternalCMV = simContext->getPrenatalNatHistInputs()->weeklyPrimaryCMV;
+    }
+    probMildIllness = simContext->getPrenatalNatHistInputs()->weeklyProbMildIllness;
+}
+
+/** \brief hasScheduledEventInWeek returns whether in the given week the child's infection becomes detectable or the one-time
+ * vertical transmission from a previous maternal infection is rolled for; valid for a mother with no infection during the simulation */
+bool CMVInfectionUpdater::hasScheduledEventInWeek(int week) {
+    if (patient->getChildDiseaseState()->hadCMV) {
+        return week - patient->getChildDiseaseState()->infectionTime == simContext->getPrenatalNatHistInputs()->verticalTransmissionToDetectableDelay;
+    }
+    if (patient->getMaternalDiseaseState()->prevCMVCase && !patient->getMaternalDiseaseState()->verticalTransmission) {
+        return week == simContext->getCohortInputs()->oneTimeVerticalTansmissionWeek[patient->getMaternalDiseaseState()->prevCMVPrimaryOrSecondary][patient->getMaternalDiseaseState()->prevCMVStratum];
+    }
+    return false;
+}
+
 /** \brief performMonthlyUpdates performs all of the state and statistics updates for a simulated month AFTER pregnancy */
 void CMVInfectionUpdater::performMonthlyUpdates() {
 
@@ -19,6 +19,10 @@ public:
     /* performMonthlyUpdates performs all of the state and statistics updates for a simulated month AFTER birth */
     void performMonthlyUpdates();
 
+    /* Functions used by Patient::leapQuietWeeks and BatchEngine for a mother with no active or recent infection */
+    void getQuietWeekProbs(double &probMaternalCMV, double &probMildIllness);
+    bool hasScheduledEventInWeek(int week);
+
 private:
     /* drawPhenotype draws for the type of CMV that the patient (mother or child) is infected with 
     CHANGED: FUNCTION CURRENTLY DEFINED IN PATIENT OBJECT INITIALIZATION.*/
@@ -27,11 +27,29 @@ const char *CmvUtil::FILE_EXTENSION_FOR_COSTS_OUTPUT = ".cout";
 const char *CmvUtil::FILE_EXTENSION_FOR_INPUT = ".in";
 /** *.in */
 const char *CmvUtil::FILE_EXTENSION_INPUT_SEARCH_STR = "*.in";
+/** .inb, the binary cache of a parsed .in file */
+const char *CmvUtil::FILE_EXTENSION_FOR_INPUT_CACHE = ".inb";
+/** .sweep */
+const char *CmvUtil::FILE_EXTENSION_FOR_SWEEP = ".sweep";
+/** *.sweep */
+const char *CmvUtil::FILE_EXTENSION_SWEEP_SEARCH_STR = "*.sweep";
+/** _variants.out, the table of parameter values for each run of a sweep */
+const char *CmvUtil::FILE_NAME_SUFFIX_SWEEP_VARIANTS = "_variants.out";
+/** .psa */
+const char *CmvUtil::FILE_EXTENSION_FOR_PSA = ".psa";
+/** *.psa */
+const char *CmvUtil::FILE_EXTENSION_PSA_SEARCH_STR = "*.psa";
+/** _draws.out, the table of parameter values and outcomes for each draw of a PSA */
+const char *CmvUtil::FILE_NAME_SUFFIX_PSA_DRAWS = "_draws.out";
 /** popstats.outCmvUtil*/
 const char *CmvUtil::FILE_NAME_SUMMARIES = "popstats.out";
 
 /** Vector of the file names to be run*/
 std::vector<std::string> CmvUtil::filesToRun;
+/** Vector of the sweep spec file names to be run*/
+std::vector<std::string> CmvUtil::sweepFilesToRun;
+/** Vector of the PSA spec file names to be run*/
+std::vector<std::string> CmvUtil::psaFilesToRun;
 /** The inputs directory path */
 std::string CmvUtil::inputsDirectory;
 /** The output directory path */
@@ -39,8 +57,127 @@ std::string CmvUtil::resultsDirectory;
 /** True if we're using random seed, false for fixed seed */
 bool CmvUtil::useRandomSeedByTime;
 
-/** \brief Random number generator class */
-MTRand CmvUtil::mtRand;
+/** The run seed, fixed or taken from the time; keys every patient's random streams */
+unsigned int CmvUtil::randomSeed;
+
+/** \brief Random number generator class; one per thread, rekeyed for each patient */
+thread_local PhiloxRand CmvUtil::rng;
+
+/** True if each decision site draws from its own stream (common random numbers), set from the command line before any thread starts */
+bool CmvUtil::useCommonRandomNumbers = false;
+
+/** The decision sites' streams for common random numbers mode; one set per thread, rekeyed for each patient */
+thread_local PhiloxRand CmvUtil::decisionRngs[CmvUtil::NUM_RANDOM_STREAMS];
+
+/** The ziggurat tables: for each layer, the bound below which a 32 bit draw lies inside the layer's rectangle, the
+ * scale from a draw to x, and the normal density at the layer's right edge; filled once before main starts */
+uint32_t CmvUtil::zigguratBounds[CmvUtil::NUM_ZIGGURAT_LAYERS];
+double CmvUtil::zigguratWidths[CmvUtil::NUM_ZIGGURAT_LAYERS];
+double CmvUtil::zigguratDensities[CmvUtil::NUM_ZIGGURAT_LAYERS];
+bool CmvUtil::zigguratTablesBuilt = CmvUtil::buildZigguratTables();
+
+/** \brief buildZigguratTables fills the ziggurat tables for 128 layers of equal area under the standard normal density
+ * \return true, so it can initialize zigguratTablesBuilt before main starts
+ **/
+bool CmvUtil::buildZigguratTables() {
+	/* Right edge of the base layer and the area of each layer, from Marsaglia and Tsang */
+	const double twoTo31 = 2147483648.0;
+	double edge = 3.442619855899;
+	double prevEdge = edge;
+	const double layerArea = 9.91256303526217e-3;
+	double baseWidth = layerArea / exp(-0.5 * edge * edge);
+
+	zigguratBounds[0] = (uint32_t) ((edge / baseWidth) * twoTo31);
+	zigguratBounds[1] = 0;
+	zigguratWidths[0] = baseWidth / twoTo31;
+	zigguratWidths[NUM_ZIGGURAT_LAYERS - 1] = edge / twoTo31;
+	zigguratDensities[0] = 1.0;
+	zigguratDensities[NUM_ZIGGURAT_LAYERS - 1] = exp(-0.5 * edge * edge);
+	for (int layer = NUM_ZIGGURAT_LAYERS - 2; layer >= 1; layer--) {
+		edge = sqrt(-2.0 * log(layerArea / edge + exp(-0.5 * edge * edge)));
+		zigguratBounds[layer + 1] = (uint32_t) ((edge / prevEdge) * twoTo31);
+		prevEdge = edge;
+		zigguratDensities[layer] = exp(-0.5 * edge * edge);
+		zigguratWidths[layer] = edge / twoTo31;
+	}
+	return true;
+} /* end buildZigguratTables */
+
+/** \brief getZigguratEdgeNormal finishes a ziggurat draw whose candidate fell outside its layer's rectangle
+ *
+ * For the base layer the value comes from the tail beyond its right edge; for the others the candidate is kept if it
+ * lies under the density curve, otherwise a new candidate is drawn
+ *
+ * \param randInt the 32 bit draw, as a signed integer
+ * \param layer the layer it selected
+ * \return a double randomly selected from N(0, 1)
+ **/
+double CmvUtil::getZigguratEdgeNormal(int32_t randInt, int layer) {
+	const double tailStart = 3.442619855899;
+	for (;;) {
+		double x = randInt * zigguratWidths[layer];
+		if (layer == 0) {
+			/* Marsaglia's tail method; uniforms are taken from (0, 1) so the logs are finite */
+			double y;
+			do {
+				x = -log((rng.randInt32() + 0.5) * (1. / 4294967296.)) / tailStart;
+				y = -log((rng.randInt32() + 0.5) * (1. / 4294967296.));
+			} while (y + y < x * x);
+			return randInt > 0 ? tailStart + x : -tailStart - x;
+		}
+		if (zigguratDensities[layer] + rng() * (zigguratDensities[layer - 1] - zigguratDensities[layer]) < exp(-0.5 * x * x)) {
+			return x;
+		}
+		randInt = (int32_t) rng.randInt32();
+		layer = randInt & (NUM_ZIGGURAT_LAYERS - 1);
+		uint32_t absRandInt = randInt < 0 ? 0u - (uint32_t) randInt : (uint32_t) randInt;
+		if (absRandInt < zigguratBounds[layer]) {
+			return randInt * zigguratWidths[layer];
+		}
+	}
+} /* end getZigguratEdgeNormal */
+
+/** \brief getInverseNormalCdf returns the value below which the standard normal distribution has the given probability
+ *
+ * Wichura's algorithm AS 241 (PPND16, Appl. Stat. 37(3), 1988), accurate to about 1e-16
+ *
+ * \param prob a probability in (0, 1)
+ * \return a double x with P(Z < x) = prob for Z ~ N(0, 1)
+ **/
+double CmvUtil::getInverseNormalCdf(double prob) {
+	double q = prob - 0.5;
+	double r, value;
+	if (fabs(q) <= 0.425) {
+		r = 0.180625 - q * q;
+		return q * (((((((r * 2509.0809287301226727 + 33430.575583588128105) * r + 67265.770927008700853) * r
+			+ 45921.953931549871457) * r + 13731.693765509461125) * r + 1971.5909503065514427) * r + 133.14166789178437745) * r
+			+ 3.387132872796366608)
+			/ (((((((r * 5226.495278852545925 + 28729.085735721942674) * r + 39307.89580009271061) * r
+			+ 21213.794301586595867) * r + 5394.1960214247511077) * r + 687.1870074920579083) * r + 42.313330701600911252) * r + 1.0);
+	}
+	r = q < 0 ? prob : 1.0 - prob;
+	if (r <= 0) {
+		return q < 0 ? -HUGE_VAL : HUGE_VAL;
+	}
+	r = sqrt(-log(r));
+	if (r <= 5.0) {
+		r -= 1.6;
+		value = (((((((r * 7.7454501427834140764e-4 + 0.0227238449892691845833) * r + 0.24178072517745061177) * r
+			+ 1.27045825245236838258) * r + 3.64784832476320460504) * r + 5.7694972214606914055) * r + 4.6303378461565452959) * r
+			+ 1.42343711074968357734)
+			/ (((((((r * 1.05075007164441684324e-9 + 5.475938084995344946e-4) * r + 0.0151986665636164571966) * r
+			+ 0.14810397642748007459) * r + 0.68976733498510000455) * r + 1.6763848301838038494) * r + 2.05319162663775882187) * r + 1.0);
+	}
+	else {
+		r -= 5.0;
+		value = (((((((r * 2.01033439929228813265e-7 + 2.71155556874348757815e-5) * r + 0.0012426609473880784386) * r
+			+ 0.026532189526576123093) * r + 0.29656057182850489123) * r + 1.7848265399172913358) * r + 5.4637849111641143699) * r
+			+ 6.6579046435011037772)
+			/ (((((((r * 2.04426310338993978564e-15 + 1.4215117583164458887e-7) * r + 1.8463183175100546818e-5) * r
+			+ 7.868691311456132591e-4) * r + 0.0148753612908506148525) * r + 0.13692988092273580531) * r + 0.59983220655588793769) * r + 1.0);
+	}
+	return q < 0 ? -value : value;
+} /* end getInverseNormalCdf */
 
 /** \brief useCurrentDirectoryForInputs determines the current directory and sets as inputs directory */
 void CmvUtil::useCurrentDirectoryForInputs() {
@@ -62,40 +199,48 @@ void CmvUtil::useCurrentDirectoryForInputs() {
 } /* end useCurrentDirectoryForInputs */
 
 /** \brief findInputFiles locates all the .in files in the current directory and adds them
-	to the filesToRun vector */
+	to the filesToRun vector, and all the .sweep and .psa files and adds them to the sweepFilesToRun and psaFilesToRun vectors */
 void CmvUtil::findInputFiles() {
+	findFiles(FILE_EXTENSION_INPUT_SEARCH_STR, filesToRun);
+	findFiles(FILE_EXTENSION_SWEEP_SEARCH_STR, sweepFilesToRun);
+	findFiles(FILE_EXTENSION_PSA_SEARCH_STR, psaFilesToRun);
+} /* end findInputFiles */
+
+/** \brief findFiles lists the files in the current directory matching a wildcard pattern
+ * \param searchStr the wildcard pattern, e.g. "*.in"
+ * \param files the vector that is replaced by the matching file names
+ **/
+void CmvUtil::findFiles(const char *searchStr, std::vector<std::string> &files) {
 #if defined(_WIN32)
 	long hFile;
 	struct _finddata_t tFileInfo;
-	hFile = _findfirst( FILE_EXTENSION_INPUT_SEARCH_STR, &tFileInfo );
-	int nInputFiles = 0;
+	hFile = _findfirst( searchStr, &tFileInfo );
 	string fileName;
 
 	//get the list of files that we have to process
-	filesToRun.clear();
+	files.clear();
+	if (hFile == -1)
+		return;
 	do {
 		fileName = (char *) tFileInfo.name;
-		filesToRun.push_back(fileName);
-		nInputFiles++;
+		files.push_back(fileName);
 	} while ( _findnext ( hFile, &tFileInfo ) == 0 );
 	_findclose( hFile );
 #else
-	glob_t files;
-	glob(FILE_EXTENSION_INPUT_SEARCH_STR, GLOB_ERR, NULL, &files);
-	int nInputFiles = 0;
+	glob_t globFiles;
+	glob(searchStr, GLOB_ERR, NULL, &globFiles);
 	string fileName;
 
-	filesToRun.clear();
+	files.clear();
 	//get the list of files that we have to process
 	int i;
-	for( i = 0; i < files.gl_pathc; i++) {
-		fileName = (char *) files.gl_pathv[i];
-		filesToRun.push_back(fileName);
-		++nInputFiles;
+	for( i = 0; i < globFiles.gl_pathc; i++) {
+		fileName = (char *) globFiles.gl_pathv[i];
+		files.push_back(fileName);
 	}
-	globfree( &files);
+	globfree( &globFiles);
 #endif
-} /* end findInputFiles */
+} /* end findFiles */
 
 /** \brief createResultsDirectory creates the directory "results" as a subdirectory of the inputs one */
 void CmvUtil::createResultsDirectory() {
@@ -207,3 +352,41 @@ void CmvUtil::closeFile(FILE *file) {
 	fclose(file);
 } /* end closeFile */
 
+
+/** \brief readFileContents reads an entire file into a string with a single read
+ *
+ * \param filename a character array with the name of the file to read
+ * \param contents a string that is replaced by the bytes of the file
+ * \return true if the whole file was read, false if it could not be opened or read
+ */
+bool CmvUtil::readFileContents(const char *filename, string &contents) {
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL)
+		return false;
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	if (size < 0) {
+		fclose(file);
+		return false;
+	}
+	contents.resize(size);
+	size_t numRead = (size > 0) ? fread(&contents[0], 1, size, file) : 0;
+	fclose(file);
+	return (numRead == (size_t) size);
+} /* end readFileContents */
+
+/** \brief hashBytes returns the 64 bit FNV-1a hash of a block of memory, used to key caches by file contents
+ *
+ * \param data a pointer to the bytes to hash
+ * \param size the number of bytes
+ * \return the hash value
+ */
+unsigned long long CmvUtil::hashBytes(const char *data, size_t size) {
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= (unsigned char) data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+} /* end hashBytes */
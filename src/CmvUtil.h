@@ -19,16 +19,26 @@ public:
     static const char *FILE_EXTENSION_FOR_COSTS_OUTPUT;
     static const char *FILE_EXTENSION_FOR_INPUT;
     static const char *FILE_EXTENSION_INPUT_SEARCH_STR;
+    static const char *FILE_EXTENSION_FOR_INPUT_CACHE;
+    static const char *FILE_EXTENSION_FOR_SWEEP;
+    static const char *FILE_EXTENSION_SWEEP_SEARCH_STR;
+    static const char *FILE_NAME_SUFFIX_SWEEP_VARIANTS;
+    static const char *FILE_EXTENSION_FOR_PSA;
+    static const char *FILE_EXTENSION_PSA_SEARCH_STR;
+    static const char *FILE_NAME_SUFFIX_PSA_DRAWS;
     static const char *FILE_NAME_SUMMARIES;
 
-    /* Vector of the file names to be run, and the inputs and results directories path */
+    /* Vector of the file names to be run, the sweep and PSA spec files to be run, and the inputs and results directories path */
     static std::vector<std::string> filesToRun;
+    static std::vector<std::string> sweepFilesToRun;
+    static std::vector<std::string> psaFilesToRun;
     static std::string inputsDirectory;
     static std::string resultsDirectory;
 
     /* Functions for handling directories and locating the input files */
 	static void useCurrentDirectoryForInputs();
 	static void findInputFiles();
+	static void findFiles(const char *searchStr, std::vector<std::string> &files);
 	static void createResultsDirectory();
 	static void changeDirectoryToResults();
 	static void changeDirectoryToInputs();
@@ -38,16 +48,53 @@ public:
 	static void getTimeString(char *buffer, int bufsize);
 	static int getTrimester(Patient *patient);
 
+	/** Decision sites that draw from their own stream in common random numbers mode: STREAM_DEFAULT is the patient's main
+	 * stream, used by patient initialization and whenever the mode is off; STREAM_TEST_RESULT is followed by one stream per
+	 * prenatal test, indexed by SimContext::PRENATAL_TESTS */
+	enum RANDOM_STREAM {STREAM_DEFAULT, STREAM_MATERNAL_INFECTION, STREAM_MATERNAL_SYMPTOMS, STREAM_VERTICAL_TRANSMISSION,
+		STREAM_CHILD_PHENOTYPE, STREAM_PREGNANCY_OUTCOME, STREAM_TREATMENT_EFFECT, STREAM_ATTENDANCE, STREAM_TEST_TRIGGER,
+		STREAM_TEST_OFFER, STREAM_RESULT_RETURN, STREAM_FOLLOW_UP, STREAM_TEST_RESULT};
+	static const int NUM_RANDOM_STREAMS = STREAM_TEST_RESULT + SimContext::NUM_PRENATAL_TESTS;
+	/** Stream of the weekly rolls BatchEngine makes for a patient in quiet weeks, apart from all the decision site streams */
+	static const int STREAM_BATCH_QUIET_WEEKS = NUM_RANDOM_STREAMS;
+
+	/** RandomState holds the random number generators of one patient, so several patients can be simulated in turn on one thread */
+	class RandomState {
+	public:
+		PhiloxRand rng;
+		PhiloxRand decisionRngs[NUM_RANDOM_STREAMS];
+	};
+
 	/* Functions and state variables for generating uniform and gaussian random numbers */
 	static void setRandomSeedType(bool useTimeSeed);
 	static void setFixedSeed(Patient *patient);
-	static double getRandomDouble();
+	static void setRandomStream(unsigned int streamId);
+	static void saveRandomState(RandomState &state);
+	static void restoreRandomState(const RandomState &state);
+	static double getRandomDouble(int streamId = STREAM_DEFAULT);
+	static void fillUniforms(double *uniforms, int n, int streamId = STREAM_DEFAULT);
+	static void rollBatch(const double *probs, bool *results, int n, int streamId = STREAM_DEFAULT);
 	static int selectFromDist(std::vector<double>& odds, double randNum);
 	static int getRandomInt(int min, int max);
 	static double getRandomGaussian(double mean, double stdDev);
+	static double getRandomStandardNormal();
+	static double getRandomTruncatedGaussian(double mean, double stdDev, double lowerBound);
+	static double getInverseNormalCdf(double prob);
 	static bool rollBasedOnOdds(double odds);
 	static bool useRandomSeedByTime;
-	static MTRand mtRand;
+	static unsigned int randomSeed;
+	static thread_local PhiloxRand rng;
+	static bool useCommonRandomNumbers;
+	static thread_local PhiloxRand decisionRngs[NUM_RANDOM_STREAMS];
+
+	/* Tables and functions for the ziggurat normal sampler */
+	static const int NUM_ZIGGURAT_LAYERS = 128;
+	static uint32_t zigguratBounds[NUM_ZIGGURAT_LAYERS];
+	static double zigguratWidths[NUM_ZIGGURAT_LAYERS];
+	static double zigguratDensities[NUM_ZIGGURAT_LAYERS];
+	static bool zigguratTablesBuilt;
+	static bool buildZigguratTables();
+	static double getZigguratEdgeNormal(int32_t randInt, int layer);
 
 	/* Probability modification functions */
 	static double probToRate(double prob);
@@ -61,62 +108,207 @@ public:
 	static bool fileExists(const char *filename);
 	static FILE *openFile(const char *filename, const char *mode);
 	static void closeFile(FILE *file);
+	static bool readFileContents(const char *filename, string &contents);
+	static unsigned long long hashBytes(const char *data, size_t size);
 };
 
-/** \brief setRandomSeedType sets up the random number generator to use seed by time (i.e. random seed) or fixed seed
+/** \brief setRandomSeedType sets up the run seed to use seed by time (i.e. random seed) or fixed seed
+ *
+ * Must be called before any threads start simulating patients; the run seed is shared by all threads
  *
  * \param useTimeSeed a boolean that determines whether to use fixed or random seed: if true, use random, else use fixed
  **/
 inline void CmvUtil::setRandomSeedType(bool useTimeSeed) {
 	useRandomSeedByTime = useTimeSeed;
 	if (useRandomSeedByTime)
-		mtRand.seed((unsigned int) time(0));
+		randomSeed = (unsigned int) time(0);
 	else
-		mtRand.seed(8675309);
+		randomSeed = 8675309;
+	rng.seed(randomSeed, 0);
 } /* end setRandomSeedType */
 
-/** \brief setfixed seed type sets the seed using the patient number
+/** \brief setFixedSeed keys this thread's random number generator by the run seed and the patient number
+ *
+ * A patient's draws depend only on (run seed, patient number, stream id), so any patient can be simulated in
+ * isolation and in any order on any thread. Resets to stream 0, and in common random numbers mode restarts every
+ * decision site's stream.
+ *
+ * With antithetic pairs, patients 2k and 2k+1 share the key k and the second one's draws are mirrored, so every
+ * uniform u of the first patient is 1 - u for the second and every normal z is -z
  *
+ * \param patient a pointer to the Patient about to be simulated
  */
 inline void CmvUtil::setFixedSeed(Patient *patient){
-	mtRand.seed(patient->getGeneralState()->patientNum);
+	int patientNum = patient->getGeneralState()->patientNum;
+	bool mirrored = false;
+	if (patient->simContext->getRunSpecsInputs()->antitheticPairs) {
+		mirrored = (patientNum % 2 == 1);
+		patientNum /= 2;
+	}
+	rng.seed(randomSeed, patientNum);
+	rng.setMirrored(mirrored);
+	if (useCommonRandomNumbers) {
+		for (int streamId = STREAM_DEFAULT + 1; streamId < NUM_RANDOM_STREAMS; streamId++) {
+			decisionRngs[streamId].seed(randomSeed, patientNum);
+			decisionRngs[streamId].setStream(streamId);
+			decisionRngs[streamId].setMirrored(mirrored);
+		}
+	}
 }/* end setFixedSeed */
 
+/** \brief setRandomStream switches the current patient's draws to another independent stream
+ *
+ * \param streamId an unsigned integer identifying the stream; stream 0 is selected by setFixedSeed
+ */
+inline void CmvUtil::setRandomStream(unsigned int streamId){
+	rng.setStream(streamId);
+}/* end setRandomStream */
+
+/** \brief saveRandomState copies this thread's generators into state; the decision site streams are only copied in
+ * common random numbers mode, since they are unused otherwise
+ *
+ * \param state the RandomState to copy the generators into
+ */
+inline void CmvUtil::saveRandomState(RandomState &state) {
+	state.rng = rng;
+	if (useCommonRandomNumbers) {
+		for (int streamId = STREAM_DEFAULT + 1; streamId < NUM_RANDOM_STREAMS; streamId++) {
+			state.decisionRngs[streamId] = decisionRngs[streamId];
+		}
+	}
+} /* end saveRandomState */
+
+/** \brief restoreRandomState makes this thread's generators continue from where saveRandomState left them
+ *
+ * \param state the RandomState to restore
+ */
+inline void CmvUtil::restoreRandomState(const RandomState &state) {
+	rng = state.rng;
+	if (useCommonRandomNumbers) {
+		for (int streamId = STREAM_DEFAULT + 1; streamId < NUM_RANDOM_STREAMS; streamId++) {
+			decisionRngs[streamId] = state.decisionRngs[streamId];
+		}
+	}
+} /* end restoreRandomState */
+
 /** \brief getRandomDouble returns a random number within the range [0,1)
  *
- * \param callSiteId an integer specifying what function called the random number generator: was used for synchronized fixed seed and now no longer has a function
- * \param patient a pointer to the Patient; was used for synchronized fixed seed and now no longer has a function
+ * In common random numbers mode each decision site draws from its own stream of the patient, so the n-th draw at a
+ * site is the same in every scenario no matter how many draws other sites took; paired scenarios that differ only in
+ * testing or treatment then see the same infections, transmissions and outcomes wherever their paths agree.
+ * Otherwise every site draws from the patient's main stream.
+ *
+ * \param streamId the RANDOM_STREAM of the decision site making the draw
  * \return a double randomly selected in the range [0,1)
  **/
-inline double CmvUtil::getRandomDouble() {
-	return mtRand();
+inline double CmvUtil::getRandomDouble(int streamId) {
+	if (useCommonRandomNumbers && streamId != STREAM_DEFAULT) {
+		return decisionRngs[streamId]();
+	}
+	return rng();
 } /* end getRandomDouble */
 
+/** \brief fillUniforms fills an array with the next n draws of getRandomDouble for the decision site, generating them
+ * several Philox blocks at a time (with AVX2 where the build targets it)
+ *
+ * \param uniforms the array to fill, of at least n doubles
+ * \param n the number of draws
+ * \param streamId the RANDOM_STREAM of the decision site making the draws
+ **/
+inline void CmvUtil::fillUniforms(double *uniforms, int n, int streamId) {
+	if (useCommonRandomNumbers && streamId != STREAM_DEFAULT) {
+		decisionRngs[streamId].fillUniforms(uniforms, n);
+	}
+	else {
+		rng.fillUniforms(uniforms, n);
+	}
+} /* end fillUniforms */
+
+/** \brief rollBatch makes n rolls at once, results[i] being true with probability probs[i]; the same outcomes as n calls to
+ * rollBasedOnOdds, with the uniforms generated by fillUniforms and compared in a loop the compiler can vectorize
+ *
+ * \param probs the probability of each roll coming up true
+ * \param results the array of at least n outcomes to fill
+ * \param n the number of rolls
+ * \param streamId the RANDOM_STREAM of the decision site making the rolls
+ **/
+inline void CmvUtil::rollBatch(const double *probs, bool *results, int n, int streamId) {
+	const int CHUNK_SIZE = 256;
+	double uniforms[CHUNK_SIZE];
+	for (int start = 0; start < n; start += CHUNK_SIZE) {
+		int chunk = min(CHUNK_SIZE, n - start);
+		fillUniforms(uniforms, chunk, streamId);
+		for (int i = 0; i < chunk; i++) {
+			results[start + i] = uniforms[i] < probs[start + i];
+		}
+	}
+} /* end rollBatch */
 
 
 /** \brief getRandomGaussian returns a random normally distributed value with the specified mean and standard deviation
  *
  * \param mean a double representing the mean of the normal distribution
  * \param stdDev a double representing the standard deviation of the normal distribution
- * \param callSiteId an integer specifying what function called the random number generator: was used for synchronized fixed seed and now no longer has a function
- * \param patient a pointer to the Patient; was used for synchronized fixed seed and now no longer has a function
  * \return a double randomly selected from the defined distribution
  **/
 inline double CmvUtil::getRandomGaussian(double mean, double stdDev) {
-	// Polar form of Box-Muller transformation
-    double x1, x2, w, y1, y2;
-	do {
-		x1 = 2.0 * mtRand() - 1.0;
-		x2 = 2.0 * mtRand() - 1.0;
-		w = x1 * x1 + x2 * x2;
-	} while ( w >= 1.0 );
-	w = sqrt( (-2.0 * log( w ) ) / w );
-	y1 = x1 * w;
-	y2 = x2 * w;
-
-	return (mean + (y2 * stdDev));
+	return mean + stdDev * getRandomStandardNormal();
 } /* end getRandomGaussian */
 
+/** \brief getRandomStandardNormal returns a random value from the standard normal distribution using the ziggurat method
+ *
+ * Marsaglia and Tsang's ziggurat (J. Stat. Softw. 5(8), 2000) with 128 layers: the low 7 bits of one 32 bit draw pick a
+ * layer and the whole draw, as a signed integer, is the candidate. About 99% of the time the candidate lies inside the
+ * layer's rectangle and is returned after one draw and one multiply; otherwise getZigguratEdgeNormal finishes the draw.
+ *
+ * When the generator is mirrored for an antithetic patient, the draw is unmirrored and the result negated, so the
+ * pair gets z and -z rather than two unrelated values from different layers
+ *
+ * \return a double randomly selected from N(0, 1)
+ **/
+inline double CmvUtil::getRandomStandardNormal() {
+	bool mirrored = rng.isMirrored();
+	int32_t randInt = (int32_t) rng.randInt32();
+	if (mirrored) {
+		randInt = ~randInt;
+	}
+	int layer = randInt & (NUM_ZIGGURAT_LAYERS - 1);
+	uint32_t absRandInt = randInt < 0 ? 0u - (uint32_t) randInt : (uint32_t) randInt;
+	double value;
+	if (absRandInt < zigguratBounds[layer]) {
+		value = randInt * zigguratWidths[layer];
+	}
+	else {
+		value = getZigguratEdgeNormal(randInt, layer);
+	}
+	return mirrored ? -value : value;
+} /* end getRandomStandardNormal */
+
+/** \brief getRandomTruncatedGaussian returns a random value from a normal distribution truncated below at lowerBound
+ *
+ * Uses the inverse CDF on the upper tail, so every call takes exactly one draw from the generator no matter how much
+ * of the distribution lies below the bound, unlike redrawing until the value is in range
+ *
+ * \param mean a double representing the mean of the untruncated normal distribution
+ * \param stdDev a double representing the standard deviation of the untruncated normal distribution
+ * \param lowerBound the smallest value that can be returned
+ * \return a double randomly selected from the truncated distribution; max(mean, lowerBound) if stdDev is not positive,
+ * in which case the draw is still taken so the stream stays aligned
+ **/
+inline double CmvUtil::getRandomTruncatedGaussian(double mean, double stdDev, double lowerBound) {
+	double uniform = (rng.randInt32() + 0.5) * (1. / 4294967296.); // in (0, 1)
+	if (stdDev <= 0) {
+		return max(mean, lowerBound);
+	}
+	/* Probability above the bound; the draw's upper tail probability is uniform on (0, upperTailProb) */
+	double upperTailProb = 0.5 * erfc((lowerBound - mean) / (stdDev * sqrt(2.0)));
+	if (upperTailProb <= 0) {
+		return lowerBound;
+	}
+	double value = mean - stdDev * getInverseNormalCdf(uniform * upperTailProb);
+	return max(value, lowerBound);
+} /* end getRandomTruncatedGaussian */
+
 /** \brief probToRate converts a probability to a rate
  *
  * \f$ rate = -\log (1 - prob) \f$
@@ -189,43 +381,50 @@ inline double CmvUtil::probLogitAdjustment(double prob, double logitAdjust) {
 	return logitToProb(probToLogit(prob) + logitAdjust);
 }
 
-/** \brief selectFromDist takes in a vector of floats containing probabilities and a float between 0 and 1 to determine which index
+/** \brief selectFromDist takes in a vector of doubles containing probabilities and a double between 0 and 1 to determine which index
  * of the vector to pick
+ *
+ * Sums the odds in a single pass without allocating; distributions sampled every week are precomputed as DiscreteDist in SimContext instead
  * 
- * \param odds a float vector containing the odds of each index being selected. The contents of the vector must sum to 1 for proper use of function. 
- * \param randNum a float that is used to pick which index is picked. Should use a randomly generated float between 0 and 1. 
+ * \param odds a double vector containing the odds of each index being selected. The contents of the vector must sum to 1 for proper use of function. 
+ * \param randNum a double that is used to pick which index is picked. Should use a randomly generated double in [0,1). 
 */
 inline int CmvUtil::selectFromDist(std::vector<double>& odds, double randNum) {
-    vector<float> sumOdds(odds.size() + 1, 0);
-    sumOdds[0] = 0;
-	int returnInt = -1;
-    for (int i = 1; i <= odds.size(); i++) {
-        for (int n = 0; n < i; n++) {
-            sumOdds[i] = sumOdds[i] + odds[n];
-        }
-    }
-    for (int i = 0; i <= odds.size(); i++) {
-        if (randNum > sumOdds[i] && randNum <= sumOdds[i + 1]) {
-            returnInt = i;
-        }
-    }
-	if (returnInt < 0) {
-		cout << "WARNING: selectFromDist did not properly select an outcome." <<endl;
-	}
-    return returnInt; // if nothing happens, return -1 to indicate error occurred
+	double sumOdds = 0;
+	for (int i = 0; i < odds.size(); i++) {
+		sumOdds += odds[i];
+		if (randNum < sumOdds) {
+			return i;
+		}
+	}
+	cout << "WARNING: selectFromDist did not properly select an outcome." <<endl;
+	return -1; // if nothing happens, return -1 to indicate error occurred
 }
 
 /** \brief getRandomInt returns an integer within a range specified by a min and max 
+ *
+ * Uses Lemire's multiply-shift method (ACM TOMACS 29(1), 2019): the high 32 bits of a 32 bit draw times the size of
+ * the range, rejecting the few draws that would make some values more likely than others. The division computing the
+ * rejection threshold is only needed in the rare case the low bits land below the range size.
  * 
  * \param min the minimum in the range
- * \param max the maximum in the range
+ * \param max the maximum in the range, exclusive
 **/
 inline int CmvUtil::getRandomInt(int min, int max) {
-	vector<double> integerVect(max-min, 1/((double)max-(double)min));
-	double randNum = mtRand();
-	int randInt = selectFromDist(integerVect, randNum);
-	randInt = randInt + min;
-	return randInt;
+	if (max <= min) {
+		return min;
+	}
+	uint32_t rangeSize = (uint32_t) ((long long) max - (long long) min);
+	uint64_t product = (uint64_t) rng.randInt32() * rangeSize;
+	uint32_t lowBits = (uint32_t) product;
+	if (lowBits < rangeSize) {
+		uint32_t threshold = (0u - rangeSize) % rangeSize;
+		while (lowBits < threshold) {
+			product = (uint64_t) rng.randInt32() * rangeSize;
+			lowBits = (uint32_t) product;
+		}
+	}
+	return (int) ((long long) min + (long long) (product >> 32));
 }
 
 /** \brief rollBasedOnOdds takes in a probability and rolls for true based on that probability 
@@ -233,7 +432,7 @@ inline int CmvUtil::getRandomInt(int min, int max) {
 */
 inline bool CmvUtil::rollBasedOnOdds(double odds) {
 	bool result = false;
-	double randNum = mtRand();
+	double randNum = rng();
 	if (randNum < odds) {
 		result = true;
 	}
@@ -21,10 +21,280 @@
 
 string TRUE_FALSE[2] = {"False", "True"};
 
+/** \brief simulatePatients runs the patients numbered [firstPatient, lastPatient) through their pregnancies, accumulating
+ * into the given RunStats and CostStats objects. Each patient reseeds the random number generator with its own patient number,
+ * so the results for a patient do not depend on which thread (or in which order) it is simulated. In batch mode the
+ * untraced patients are handed to a BatchEngine, unless the cohort is run in antithetic pairs, whose paired estimator
+ * needs the two patients of a pair to finish one after the other.
+ *
+ * \param simContext a pointer to the SimContext for this run
+ * \param runStats a pointer to the RunStats object (or per-thread shard) to accumulate into
+ * \param costStats a pointer to the CostStats object (or per-thread shard) to accumulate into
+ * \param tracer a pointer to the Tracer for this run
+ * \param firstPatient the number of the first patient to simulate
+ * \param lastPatient one past the number of the last patient to simulate
+ **/
+void simulatePatients(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer, int firstPatient, int lastPatient) {
+    int firstBatchPatient = lastPatient;
+    if (BatchEngine::useBatchMode && !simContext->getRunSpecsInputs()->antitheticPairs) {
+        firstBatchPatient = max(firstPatient, min(lastPatient, simContext->getRunSpecsInputs()->numberOfPatientsToTrace));
+    }
+    /** One Patient object is created per call (i.e. per thread) and reset in place for each patient in the range */
+    Patient *patient = NULL;
+    for (int numRun = firstPatient; numRun < firstBatchPatient; numRun++) {
+        bool trace = false;
+        if (numRun < simContext->getRunSpecsInputs()->numberOfPatientsToTrace) {
+            trace = true;
+        }
+        /* Create the Patient object for the first patient, reinitialize it for the rest */
+        if (patient == NULL) {
+            patient = new Patient(simContext, runStats, costStats, tracer, numRun, trace);
+        }
+        else {
+            patient->reset(numRun, trace);
+        }
+
+        /** Printing initial patient stats to trace */
+        if (patient->getGeneralState()->tracingEnabled) {
+            tracer->printTrace(1, "Patient #%d \n", numRun);
+            tracer->printTrace(1, "    Tracing enabled: %s, Maternal Age (years): %d\n", TRUE_FALSE[patient->getGeneralState()->tracingEnabled].c_str(),
+                    patient->getMaternalState()->maternalAgeYears);
+            tracer->printTrace(1, "    Prevalent CMV: %s, Previous CMV: %s, ", TRUE_FALSE[patient->getMaternalDiseaseState()->isPrevalentCMVCase].c_str(),
+                TRUE_FALSE[patient->getMaternalDiseaseState()->prevCMVCase].c_str());
+            if (patient->getMaternalDiseaseState()->weekLastCMV < -5000) {
+                tracer->printTrace(1, "Week Last CMV: NEVER\n");
+            }
+            else {
+                tracer->printTrace(1, "Week Last CMV: %d\n", patient->getMaternalDiseaseState()->weekLastCMV);
+            }
+            tracer->printTrace(1, "BEGIN WEEKLY SIM\n");
+        }
+        
+        /** While delivery has not occurred and child is alive, loop over the pregnancy of the patient and simulate weeks */
+
+        while (!patient->getChildState()->deliveryOcurred && patient->getChildState()->isAlive) {
+            patient->simulateWeek();             
+        }
+        /* End of pregnancy */
+        
+        /** Simulate life months of child until death */
+        // THIS WILL BE CODE FOR SIMULATING THE CHILD'S LIFE. WILL NOT BE USED FOR FIRST PART OF MODEL DEVELOPMENT
+
+        /* End of life */
+        if (patient->getGeneralState()->tracingEnabled) {
+            tracer->printTrace(1, "\n");
+        }
+    }
+    delete patient;
+
+    if (firstBatchPatient < lastPatient) {
+        BatchEngine batchEngine(simContext, runStats, costStats, tracer);
+        batchEngine.simulatePatients(firstBatchPatient, lastPatient);
+    }
+} /* end simulatePatients */
+
+/** \brief simulateRange splits the patients numbered [firstPatient, lastPatient) into contiguous ranges, one per thread, and
+ * simulates them. This thread takes the first range and accumulates directly into runStats/costStats; thread i > 0
+ * accumulates into shard i - 1.
+ *
+ * \param simContext a pointer to the SimContext for this run
+ * \param runStats a pointer to the RunStats object this thread accumulates into
+ * \param costStats a pointer to the CostStats object this thread accumulates into
+ * \param tracer a pointer to the Tracer for this run
+ * \param runStatsShards the RunStats shards of the other threads
+ * \param costStatsShards the CostStats shards of the other threads
+ * \param firstPatient the number of the first patient to simulate
+ * \param lastPatient one past the number of the last patient to simulate
+ * \param rangeAlignment every range but the last holds a multiple of this many patients, so antithetic pairs are never split
+ **/
+void simulateRange(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer, vector<RunStats *> &runStatsShards,
+        vector<CostStats *> &costStatsShards, int firstPatient, int lastPatient, int rangeAlignment) {
+    int numThreads = (int) runStatsShards.size() + 1;
+    int numPatients = lastPatient - firstPatient;
+    vector<int> rangeBounds(numThreads + 1, 0);
+    for (int i = 0; i < numThreads; i++) {
+        rangeBounds[i] = firstPatient + (int)(((long long)(numPatients / rangeAlignment) * i) / numThreads) * rangeAlignment;
+    }
+    rangeBounds[numThreads] = lastPatient;
+    vector<thread> workers;
+    for (int i = 1; i < numThreads; i++) {
+        workers.push_back(thread(simulatePatients, simContext, runStatsShards[i - 1], costStatsShards[i - 1], tracer, rangeBounds[i], rangeBounds[i + 1]));
+    }
+    simulatePatients(simContext, runStats, costStats, tracer, rangeBounds[0], rangeBounds[1]);
+    for (int i = 0; i < (int) workers.size(); i++) {
+        workers[i].join();
+    }
+} /* end simulateRange */
+
+/** \brief runSimContext simulates the cohort for one set of inputs, writes its .out and trace files, and adds it to the summary stats
+ *
+ * \param simContext a pointer to the SimContext holding the inputs; its run name names the output files
+ * \param summaryStats a pointer to the SummaryStats object collecting the popstats rows
+ * \param numThreads the number of threads to split the cohort across
+ **/
+void runSimContext(SimContext *simContext, SummaryStats *summaryStats, int numThreads) {
+    string runName = simContext->getRunSpecsInputs()->runName;
+
+    /** Initializes the random number generator with either a random or fixed seed */
+    CmvUtil::setRandomSeedType(false); // use fixed seed only for now.
+
+    /* Create a new run statistics object for this simulation context */
+    RunStats *runStats = new RunStats(runName, simContext);
+    CostStats *costStats = new CostStats(runName, simContext);
+    Tracer *tracer = new Tracer(runName, simContext, 1);
+
+    tracer->openTraceFile();
+    tracer->printTraceHeader();
+
+    /** Load the number of cohorts and settings for stopping simulation */
+    int numCohortsLimit = simContext->getRunSpecsInputs()->numCohorts;
+
+    CmvUtil::changeDirectoryToResults();
+  
+
+    /* Patient statistics counting vectors */
+    vector<int> NUM_IN_EACH_SUBCOHORT(5, 0);
+    vector<float> PROPORTION_IN_EACH_SUBCOHORT(5, 0);
+    double sumMaternalAge = 0;
+    double sumSquaredMaternalAge = 0;
+    double meanMaternalAge;
+    double stdDevMaternalAge;
+    int numPrevCMV = 0;
+
+    /** Traced patients are simulated first on this thread so the trace file is written in patient order */
+    int numTraced = min(max(simContext->getRunSpecsInputs()->numberOfPatientsToTrace, 0), max(numCohortsLimit, 0));
+    /** Antithetic pairs are never split between ranges, so every range starts on an even patient number */
+    int rangeAlignment = simContext->getRunSpecsInputs()->antitheticPairs ? 2 : 1;
+    numTraced = min(numTraced + numTraced % rangeAlignment, max(numCohortsLimit, 0));
+    simulatePatients(simContext, runStats, costStats, tracer, 0, numTraced);
+
+    /** Every thread but this one accumulates into its own shard, merged in afterwards */
+    vector<RunStats *> runStatsShards;
+    vector<CostStats *> costStatsShards;
+    for (int i = 1; i < numThreads; i++) {
+        runStatsShards.push_back(new RunStats(runName, simContext));
+        costStatsShards.push_back(new CostStats(runName, simContext));
+    }
+
+    /** With a target precision the rest of the cohort is simulated convergenceCheckInterval patients at a time, stopping
+     * at the end of the first interval after which every key outcome's confidence interval is narrow enough; otherwise
+     * it is simulated in one go */
+    double targetRelativeHalfWidth = simContext->getRunSpecsInputs()->targetRelativeHalfWidth;
+    int checkInterval = max(numCohortsLimit - numTraced, 1);
+    if (targetRelativeHalfWidth > 0) {
+        checkInterval = simContext->getRunSpecsInputs()->convergenceCheckInterval;
+        checkInterval += checkInterval % rangeAlignment;
+    }
+    int numSimulated = numTraced;
+    while (numSimulated < numCohortsLimit) {
+        int intervalEnd = (int) min((long long) numSimulated + checkInterval, (long long) numCohortsLimit);
+        simulateRange(simContext, runStats, costStats, tracer, runStatsShards, costStatsShards, numSimulated, intervalEnd, rangeAlignment);
+        numSimulated = intervalEnd;
+        if (targetRelativeHalfWidth > 0) {
+            RunStats::PrecisionSummary precision = *runStats->getPrecisionSummary();
+            for (int i = 0; i < (int) runStatsShards.size(); i++) {
+                RunStats::addPrecisionSummary(precision, *runStatsShards[i]->getPrecisionSummary());
+            }
+            if (RunStats::isPrecisionReached(precision, targetRelativeHalfWidth)) {
+                break;
+            }
+        }
+    }
+    /** Merge the shards in thread order */
+    for (int i = 0; i < (int) runStatsShards.size(); i++) {
+        runStats->addRunStats(runStatsShards[i]);
+        costStats->addCostStats(costStatsShards[i]);
+        delete runStatsShards[i];
+        delete costStatsShards[i];
+    }
+
+    /** Write out the stats file for this simulation context and add to the summary stats */
+		runStats->finalizeStats();
+    try {
+        runStats->writeStatsFile();
+    }
+    catch (string &errorString) {
+        printf("%s\n", errorString.c_str());
+    }
+    
+    /** Add the individual run stats to the summary stats object */
+    summaryStats->addRunStats(runStats);
+
+    tracer->closeTraceFile();
+    delete tracer;
+
+    /** destroy the runStats, costStats, and simContext objects */
+    delete runStats;
+    delete costStats;
+} /* end runSimContext */
+
+/** \brief runPsaDraws takes draws from the shared counter until none are left, simulating each draw's cohort on this thread
+ * and streaming its row to the draws file. Several threads run this at once, one draw each at a time.
+ *
+ * \param psaSpec a pointer to the PsaSpec describing the draws, with its draws file open
+ * \param baseContext a pointer to the SimContext holding the parsed base inputs, copied for each draw and not modified
+ * \param nextDraw the number of the next draw to be taken, shared by all the threads
+ **/
+void runPsaDraws(PsaSpec *psaSpec, SimContext *baseContext, atomic<int> *nextDraw) {
+    vector<double> values;
+    for (int drawNum = (*nextDraw)++; drawNum < psaSpec->getNumDraws(); drawNum = (*nextDraw)++) {
+        SimContext *drawContext = new SimContext(*baseContext);
+        psaSpec->drawValues(drawNum, values);
+        psaSpec->applyDraw(drawContext, drawNum, values);
+
+        string runName = drawContext->getRunSpecsInputs()->runName;
+        RunStats *runStats = new RunStats(runName, drawContext);
+        CostStats *costStats = new CostStats(runName, drawContext);
+        Tracer *tracer = new Tracer(runName, drawContext, 1);
+        simulatePatients(drawContext, runStats, costStats, tracer, 0, drawContext->getRunSpecsInputs()->numCohorts);
+        runStats->finalizeStats();
+        psaSpec->writeDrawRow(drawNum, values, runStats);
+
+        delete tracer;
+        delete runStats;
+        delete costStats;
+        delete drawContext;
+    }
+} /* end runPsaDraws */
+
 /** \brief Main function for a console based application */
 int main(int argc, char *argv[]) {
-    if (argc > 1) {
-        CmvUtil::inputsDirectory = argv[1];
+    /** Parse the command line: an optional inputs directory, an optional "--threads N", and the optional flags "--crn", "--leap" and "--batch" */
+    string inputsDirectoryArg = "";
+    int numThreads = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            numThreads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--crn") == 0) {
+            CmvUtil::useCommonRandomNumbers = true;
+        }
+        else if (strcmp(argv[i], "--leap") == 0) {
+            Patient::useLeapMode = true;
+        }
+        else if (strcmp(argv[i], "--batch") == 0) {
+            BatchEngine::useBatchMode = true;
+        }
+        else if (inputsDirectoryArg.empty()) {
+            inputsDirectoryArg = argv[i];
+        }
+    }
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    /* The batch engine draws the quiet-week rolls of its lanes from one shared stream, not from the decision-site streams of
+    common random numbers, so with --crn every patient is simulated one by one */
+    if (BatchEngine::useBatchMode && CmvUtil::useCommonRandomNumbers) {
+        printf("--batch is not used with --crn: patients are simulated one by one so that each decision site keeps its own random stream\n");
+        BatchEngine::useBatchMode = false;
+    }
+    /* The batch engine steps its patients one week at a time, so it does its own skipping of quiet weeks */
+    if (BatchEngine::useBatchMode) {
+        Patient::useLeapMode = false;
+    }
+
+    if (!inputsDirectoryArg.empty()) {
+        CmvUtil::inputsDirectory = inputsDirectoryArg;
         CmvUtil::changeDirectoryToInputs();
     }
     else {
@@ -78,103 +348,83 @@ int main(int argc, char *argv[]) {
         
         catch (string &errorString) {
             printf("%s\n", errorString.c_str());
+            delete simContext;
             continue;
         }
 
-        /** Initializes the random number generator with either a random or fixed seed */
-        CmvUtil::setRandomSeedType(false); // use fixed seed only for now.
-
-        /* Create a new run statistics object for this simulation context */
-        RunStats *runStats = new RunStats(runName, simContext);
-        CostStats *costStats = new CostStats(runName, simContext);
-        Tracer *tracer = new Tracer(runName, simContext, 1);
-
-        tracer->openTraceFile();
-        tracer->printTraceHeader();
+        runSimContext(simContext, summaryStats, numThreads);
+        delete simContext;
 
-        /** Load the number of cohorts and settings for stopping simulation */
-        int numCohortsLimit = simContext->getRunSpecsInputs()->numCohorts;
-        int numRun = 0;
+    };
 
-        CmvUtil::changeDirectoryToResults();
-  
+    /** Loop over the sweep files: parse each base input once and run a copy of it per combination of parameter values */
+    for (vector<string>::iterator sweepFileIter = CmvUtil::sweepFilesToRun.begin();
+        sweepFileIter != CmvUtil::sweepFilesToRun.end(); sweepFileIter++) {
 
-        /* Patient statistics counting vectors */
-        vector<int> NUM_IN_EACH_SUBCOHORT(5, 0);
-        vector<float> PROPORTION_IN_EACH_SUBCOHORT(5, 0);
-        double sumMaternalAge = 0;
-        double sumSquaredMaternalAge = 0;
-        double meanMaternalAge;
-        double stdDevMaternalAge;
-        int numPrevCMV = 0;
-        
-        while (numRun < numCohortsLimit ) {
-            bool trace = false;
-            if (numRun < simContext->getRunSpecsInputs()->numberOfPatientsToTrace) {
-                trace = true;
-            }
-            /* Create Patient object */
-            Patient *patient = new Patient(simContext, runStats, costStats, tracer, numRun, trace);
-
-            /* Setting up the state updaters for the patient */
-            StateUpdater* stateUpdater = new StateUpdater(patient);
-
-            /** Printing initial patient stats to trace */
-            if (patient->getGeneralState()->tracingEnabled) {
-                tracer->printTrace(1, "Patient #%d \n", numRun);
-                tracer->printTrace(1, "    Tracing enabled: %s, Maternal Age (years): %d\n", TRUE_FALSE[patient->getGeneralState()->tracingEnabled].c_str(),
-                        patient->getMaternalState()->maternalAgeYears);
-                tracer->printTrace(1, "    Prevalent CMV: %s, Previous CMV: %s, ", TRUE_FALSE[patient->getMaternalDiseaseState()->isPrevalentCMVCase].c_str(),
-                    TRUE_FALSE[patient->getMaternalDiseaseState()->prevCMVCase].c_str());
-                if (patient->getMaternalDiseaseState()->weekLastCMV < -5000) {
-                    tracer->printTrace(1, "Week Last CMV: NEVER\n");
-                }
-                else {
-                    tracer->printTrace(1, "Week Last CMV: %d\n", patient->getMaternalDiseaseState()->weekLastCMV);
-                }
-                tracer->printTrace(1, "BEGIN WEEKLY SIM\n");
-            }
-            
-            /** While delivery has not occurred and child is alive, loop over the pregnancy of the patient and simulate weeks */
+        printf("Running Sweep: %s\n", (*sweepFileIter).c_str());
+        SweepSpec sweepSpec(*sweepFileIter);
+        SimContext *baseContext = NULL;
+        try {
+            sweepSpec.readSpec();
+            baseContext = new SimContext(sweepSpec.getBaseRunName());
+            baseContext->readInputs();
+            sweepSpec.validateSpec(baseContext);
+            sweepSpec.writeVariantsFile();
+        }
+        catch (string &errorString) {
+            printf("%s\n", errorString.c_str());
+            delete baseContext;
+            continue;
+        }
 
-            while (!patient->getChildState()->deliveryOcurred && patient->getChildState()->isAlive) {
-                patient->simulateWeek();             
-            }
-            /* End of pregnancy */
-            
-            /** Simulate life months of child until death */
-            // THIS WILL BE CODE FOR SIMULATING THE CHILD'S LIFE. WILL NOT BE USED FOR FIRST PART OF MODEL DEVELOPMENT
+        for (int variantNum = 0; variantNum < sweepSpec.getNumVariants(); variantNum++) {
+            SimContext *variantContext = new SimContext(*baseContext);
+            sweepSpec.applyVariant(variantContext, variantNum);
+            printf("Running Variant: %s\n", sweepSpec.getVariantRunName(variantNum).c_str());
+            runSimContext(variantContext, summaryStats, numThreads);
+            delete variantContext;
+        }
+        delete baseContext;
+    }
 
-            /* End of life */
-            if (patient->getGeneralState()->tracingEnabled) {
-                tracer->printTrace(1, "\n");
-            }
+    /** Loop over the PSA files: parse each base input once and run the draws in parallel, one cohort per draw per thread */
+    for (vector<string>::iterator psaFileIter = CmvUtil::psaFilesToRun.begin();
+        psaFileIter != CmvUtil::psaFilesToRun.end(); psaFileIter++) {
 
-            delete patient;
-            delete stateUpdater;
-            numRun++;
-        }
-        /** Write out the stats file for this simulation context and add to the summary stats */
-		runStats->finalizeStats();
+        printf("Running PSA: %s\n", (*psaFileIter).c_str());
+        PsaSpec psaSpec(*psaFileIter);
+        SimContext *baseContext = NULL;
         try {
-            runStats->writeStatsFile();
+            psaSpec.readSpec();
+            baseContext = new SimContext(psaSpec.getBaseRunName());
+            baseContext->readInputs();
+            psaSpec.validateSpec(baseContext);
+            psaSpec.openDrawsFile();
         }
         catch (string &errorString) {
             printf("%s\n", errorString.c_str());
+            delete baseContext;
+            continue;
         }
-        
-        /** Add the individual run stats to the summary stats object */
-        summaryStats->addRunStats(runStats);
 
-        tracer->closeTraceFile();
-        delete tracer;
-
-        /** destroy the runStats, costStats, and simContext objects */
-        delete runStats;
-        delete costStats;
-        delete simContext;
-
-    };
+        /** The patient seed is shared by every draw and must be set before the threads start */
+        CmvUtil::setRandomSeedType(false);
+        chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+        atomic<int> nextDraw(0);
+        vector<thread> workers;
+        for (int i = 1; i < numThreads; i++) {
+            workers.push_back(thread(runPsaDraws, &psaSpec, baseContext, &nextDraw));
+        }
+        runPsaDraws(&psaSpec, baseContext, &nextDraw);
+        for (int i = 0; i < (int) workers.size(); i++) {
+            workers[i].join();
+        }
+        double elapsedSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        psaSpec.closeDrawsFile();
+        printf("PSA %s: %d draws in %.2f seconds (%.2f draws/sec)\n", (*psaFileIter).c_str(), psaSpec.getNumDraws(),
+            elapsedSeconds, psaSpec.getNumDraws() / max(elapsedSeconds, 1e-9));
+        delete baseContext;
+    }
     /** 
      * Four parts to main function: Pregnancy/Prenatal, Postpartum (week 40 - 44), Infant (Month 1 - 24), Adult (Month 24+).
      * Important to make distinct parts because they have different timesteps and relevant update functions. 
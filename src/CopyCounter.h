@@ -0,0 +1,32 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * CountedCopies<T> is an empty member of class T that adds sizeof(T) to CountedCopies<T>::numBytesCopied each time a T
+ * is copy-constructed or copy-assigned (moves count as copies), so lincs_bench can report the bytes copied per attended
+ * appointment. It is only compiled in when the build defines LINCS_COUNT_COPIES (CMake option of the same name); the
+ * counter is shared by all threads, so it slows a build down and is meant for benchmarking only.
+*/
+#ifdef LINCS_COUNT_COPIES
+template <class T> class CountedCopies
+{
+public:
+    /** Number of bytes copied by copies of T */
+    static inline atomic<long long> numBytesCopied{0};
+
+    CountedCopies() {}
+    CountedCopies(const CountedCopies &) {
+        numBytesCopied += sizeof(T);
+    }
+    CountedCopies &operator=(const CountedCopies &) {
+        numBytesCopied += sizeof(T);
+        return *this;
+    }
+};
+
+/** COUNT_COPIES_OF(T) declares the CountedCopies member of class T */
+#define COUNT_COPIES_OF(T) CountedCopies<T> copyCounter;
+#else
+#define COUNT_COPIES_OF(T)
+#endif
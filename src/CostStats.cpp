@@ -9,8 +9,25 @@ CostStats::CostStats(string runName, SimContext *simContext) {
 	costStatsFileName = runName;
 	costStatsFileName.append(CmvUtil::FILE_EXTENSION_FOR_COSTS_OUTPUT);
 	this->simContext = simContext;
+
+	initPopulationSummary();
 }
 
 /** \brief Destructor */
 CostStats::~CostStats(void) {
 } /* end Destructor */
+
+/** \brief initPopulationSummary zeroes the population counters */
+void CostStats::initPopulationSummary() {
+	popSummary.numPatients = 0;
+	popSummary.numDetected = 0;
+} /* end initPopulationSummary */
+
+/** \brief addCostStats adds the counters of another CostStats object (e.g. a per-thread shard) into this one
+ *
+ * \param shard a pointer to the CostStats object whose counters are added to this one
+ **/
+void CostStats::addCostStats(const CostStats *shard) {
+	popSummary.numPatients += shard->popSummary.numPatients;
+	popSummary.numDetected += shard->popSummary.numDetected;
+} /* end addCostStats */
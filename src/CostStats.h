@@ -2,7 +2,8 @@
 
 #include "include.h"
 
-class CostStats
+/** CostStats is aligned to a 64 byte cache line, so the per-thread shards that worker threads update never share a line */
+class alignas(64) CostStats
 {
 public:
     /** Make the StateUpdater class a friend calss so it can modify the private data */
@@ -35,6 +36,9 @@ public:
     /* Accessor functions returning const pointers to the statistics subclass objects */
     const PopulationSummary *getPopulationSummary();
 
+    /* Function to merge a per-thread shard into this object */
+    void addCostStats(const CostStats *shard);
+
 private:
     /** Pointer to the associated simulation context */
     SimContext *simContext;
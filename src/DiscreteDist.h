@@ -0,0 +1,89 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The DiscreteDist class is a precomputed discrete distribution over a small number of outcomes. The cumulative
+ * probabilities are summed once, in double precision, when the inputs are read; sampling is then a short search
+ * over inline storage with no allocation
+*/
+class DiscreteDist
+{
+public:
+    /** Maximum number of outcomes; the largest distributions in the model are over CMV phenotypes and last-CMV strata */
+    static const int MAX_OUTCOMES = 5;
+
+    /* Constructors take in an optional array of outcome probabilities */
+    DiscreteDist();
+    DiscreteDist(const double *probs, int numOutcomes);
+
+    /* Functions to set the outcome probabilities and to sample an outcome */
+    void setProbs(const double *probs, int numOutcomes);
+    int sample(double randNum) const;
+    int getNumOutcomes() const;
+    double getCumProb(int outcome) const;
+private:
+    /** The cumulative probability of each outcome and every outcome before it */
+    double cumProbs[MAX_OUTCOMES];
+    /** The number of outcomes in use */
+    int numOutcomes;
+};
+
+/** \brief Default constructor creates an empty distribution; sample returns -1 until setProbs is called */
+inline DiscreteDist::DiscreteDist() {
+    numOutcomes = 0;
+} /* end Constructor */
+
+/** \brief Constructor builds the distribution from an array of outcome probabilities
+ * \param probs an array of the probability of each outcome
+ * \param numOutcomes the number of entries in probs
+*/
+inline DiscreteDist::DiscreteDist(const double *probs, int numOutcomes) {
+    setProbs(probs, numOutcomes);
+} /* end Constructor */
+
+/** \brief setProbs sums the outcome probabilities into the cumulative table, throws exception if there are too many outcomes
+ * \param probs an array of the probability of each outcome
+ * \param numOutcomes the number of entries in probs
+*/
+inline void DiscreteDist::setProbs(const double *probs, int numOutcomes) {
+    if (numOutcomes > MAX_OUTCOMES) {
+        string errorString = "	ERROR - DiscreteDist has more outcomes than DiscreteDist::MAX_OUTCOMES";
+        throw errorString;
+    }
+    this->numOutcomes = numOutcomes;
+    double sum = 0;
+    for (int i = 0; i < numOutcomes; i++) {
+        sum += probs[i];
+        cumProbs[i] = sum;
+    }
+} /* end setProbs */
+
+/** \brief sample returns the outcome whose slice of the cumulative table [cumProbs[i-1], cumProbs[i]) contains randNum
+ *
+ * Outcomes with zero probability are never selected
+ *
+ * \param randNum a double in the range [0,1)
+ * \return the index of the selected outcome, or -1 if randNum lies past the total probability
+**/
+inline int DiscreteDist::sample(double randNum) const {
+    for (int i = 0; i < numOutcomes; i++) {
+        if (randNum < cumProbs[i]) {
+            return i;
+        }
+    }
+    cout << "WARNING: DiscreteDist did not properly select an outcome." << endl;
+    return -1;
+} /* end sample */
+
+/** \brief getNumOutcomes returns the number of outcomes in the distribution */
+inline int DiscreteDist::getNumOutcomes() const {
+    return numOutcomes;
+} /* end getNumOutcomes */
+
+/** \brief getCumProb returns the probability of the given outcome or any outcome before it, i.e. the end of its slice of [0,1)
+ * \param outcome the index of the outcome
+*/
+inline double DiscreteDist::getCumProb(int outcome) const {
+    return cumProbs[outcome];
+} /* end getCumProb */
@@ -35,52 +35,19 @@ void EndWeekUpdater::performWeeklyUpdates() {
     }
 
     /* Determine if current diagnostic state matches any of the prenatal treatment policies. If so, begin treatment.*/
-    // NOTE: Treatment 1 is mapped to index 0 in the code, Treatment 2 is mapped to index 1, Treatmnet 3 is mapped to index 2, and so on. 
-    int NoDiagnosisTreatment = simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::NO_CMV_DIAGNOSES] - 1;
-    int MaternalCMVTreatment = simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::MATERNAL_CMV_DIAGNOSIS] - 1;
-    int FetalCMVTreatment = simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::FETAL_CMV_DIAGNOSIS] - 1;
-
-    if (!patient->getMaternalMonitoringState()->knownHadCMV && !patient->getChildMonitoringState()->knownCMV && simContext->getPrenatalTreatmentInputs()->treatmentBasedOnPolicy[SimContext::NO_CMV_DIAGNOSES] != false && 
-    patient->getGeneralState()->hadTreatment[NoDiagnosisTreatment] == false) {
+    int treatmentToStart = getTreatmentToStart();
+    if (treatmentToStart != NO_TREATMENT_TO_START) {
         setOnTreatment(true);
-        setMostRecentTreatmentNumber(NoDiagnosisTreatment);;
-        setWeekTreatmentStarted(patient->getGeneralState()->weekNum, NoDiagnosisTreatment);
-        setHadTreatment(true,  NoDiagnosisTreatment);
-        
+        setMostRecentTreatmentNumber(treatmentToStart);
+        setWeekTreatmentStarted(patient->getGeneralState()->weekNum, treatmentToStart);
+        setHadTreatment(true, treatmentToStart);
         if (patient->getGeneralState()->tracingEnabled) {
-            tracer->printTrace(1, "Treatment %d started\n",  NoDiagnosisTreatment + 1);
+            tracer->printTrace(1, "Treatment %d started\n", treatmentToStart + 1);
         }
         if (patient->getChildDiseaseState()->hadCMV){
             symptomReductionAlgorithm();
         }
     }
-    else if (patient->getMaternalMonitoringState()->knownHadCMV && !patient->getChildMonitoringState()->knownCMV && simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::MATERNAL_CMV_DIAGNOSIS]!= false &&
-    patient->getGeneralState()->hadTreatment[MaternalCMVTreatment] == false) {
-        setOnTreatment(true);
-        setMostRecentTreatmentNumber(MaternalCMVTreatment);
-        setWeekTreatmentStarted(patient->getGeneralState()->weekNum, MaternalCMVTreatment);
-        setHadTreatment(true, MaternalCMVTreatment);
-        if (patient->getGeneralState()->tracingEnabled) {
-            tracer->printTrace(1, "Treatment %d started\n", MaternalCMVTreatment + 1);
-        }
-        if (patient->getChildDiseaseState()->hadCMV){
-            symptomReductionAlgorithm();
-        }
-    }
-    else if (patient->getChildMonitoringState()->knownCMV && simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::FETAL_CMV_DIAGNOSIS] != false &&
-    patient->getGeneralState()->hadTreatment[FetalCMVTreatment] == false) {
-        setOnTreatment(true);
-        setMostRecentTreatmentNumber(FetalCMVTreatment);
-        setWeekTreatmentStarted(patient->getGeneralState()->weekNum, FetalCMVTreatment);
-        setHadTreatment(true, FetalCMVTreatment);
-        if (patient->getGeneralState()->tracingEnabled) {
-            tracer->printTrace(1, "Treatment %d started\n", FetalCMVTreatment + 1);
-        }
-        if (patient->getChildDiseaseState()->hadCMV){
-            symptomReductionAlgorithm();
-        }
-        
-    }
 
     /* Incrementing relevant RunStats statistics */
     /** If mother was diagnosed this week */
@@ -117,6 +84,9 @@ void EndWeekUpdater::performWeeklyUpdates() {
 }
 
 void EndWeekUpdater::performEndPatientUpdates() {
+    // count the patient in the run size; every patient ends once, whichever engine simulated it and wherever the run stopped
+    incrementCohortSize();
+
     /* Finalizing Patient Diagnosis Outputs */
     // if mother is diagnosed, increment the number of mothers diagnosed in runstats
     if (patient->getMaternalMonitoringState()->diagnosedCMV) {
@@ -168,4 +138,41 @@ void EndWeekUpdater::performEndPatientUpdates() {
             incrementNumCMVPositiveChildrenBornNeverTreatment();
         }
     }
-}
\ No newline at end of file
+
+    if (simContext->getRunSpecsInputs()->antitheticPairs) {
+        addPairedOutcomes(sum != 0);
+    }
+    if (simContext->getRunSpecsInputs()->infectionBiasFactor != 1) {
+        addWeightedOutcomes();
+    }
+    addPrecisionOutcomes();
+}
+
+/** \brief getTreatmentToStart returns the treatment that the policy for the current diagnostic state starts, or
+ * NO_TREATMENT_TO_START if the policy gives no treatment or the patient has already had it */
+int EndWeekUpdater::getTreatmentToStart() {
+    // NOTE: Treatment 1 is mapped to index 0 in the code, Treatment 2 is mapped to index 1, Treatmnet 3 is mapped to index 2, and so on. 
+    int NoDiagnosisTreatment = simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::NO_CMV_DIAGNOSES] - 1;
+    int MaternalCMVTreatment = simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::MATERNAL_CMV_DIAGNOSIS] - 1;
+    int FetalCMVTreatment = simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::FETAL_CMV_DIAGNOSIS] - 1;
+    if (!patient->getMaternalMonitoringState()->knownHadCMV && !patient->getChildMonitoringState()->knownCMV && simContext->getPrenatalTreatmentInputs()->treatmentBasedOnPolicy[SimContext::NO_CMV_DIAGNOSES] != false && 
+    patient->getGeneralState()->hadTreatment[NoDiagnosisTreatment] == false) {
+        return NoDiagnosisTreatment;
+    }
+    else if (patient->getMaternalMonitoringState()->knownHadCMV && !patient->getChildMonitoringState()->knownCMV && simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::MATERNAL_CMV_DIAGNOSIS]!= false &&
+    patient->getGeneralState()->hadTreatment[MaternalCMVTreatment] == false) {
+        return MaternalCMVTreatment;
+    }
+    else if (patient->getChildMonitoringState()->knownCMV && simContext->getPrenatalTreatmentInputs()->treatmentNumberBasedOnPolicy[SimContext::FETAL_CMV_DIAGNOSIS] != false &&
+    patient->getGeneralState()->hadTreatment[FetalCMVTreatment] == false) {
+        return FetalCMVTreatment;
+    }
+    return NO_TREATMENT_TO_START;
+}
+
+/** \brief performQuietWeekUpdates advances the week and trimester for a week skipped by Patient::leapQuietWeeks, in
+ * which there is no treatment, diagnosis or appointment for performWeeklyUpdates to count */
+void EndWeekUpdater::performQuietWeekUpdates() {
+    incrementWeek();
+    setPregnancyTrimester();
+}
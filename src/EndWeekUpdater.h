@@ -17,4 +17,11 @@ public:
     void performWeeklyUpdates();
     /* performEndPatientUpdates updates the relevant runstats for the end of a patient's simulation */
     void performEndPatientUpdates();
+
+    /** Returned by getTreatmentToStart when no treatment policy applies */
+    static const int NO_TREATMENT_TO_START = -1;
+    /* getTreatmentToStart returns the treatment that the policy for the current diagnoses starts this week */
+    int getTreatmentToStart();
+    /* performQuietWeekUpdates advances the week for a week skipped by Patient::leapQuietWeeks */
+    void performQuietWeekUpdates();
 };
\ No newline at end of file
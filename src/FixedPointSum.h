@@ -0,0 +1,75 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The FixedPointSum class sums doubles exactly in 64-bit integer fixed point, with FRACTION_BITS bits after the binary
+ * point. Integer addition is associative, so the total does not depend on the order in which values are added or on
+ * how the sum is split into partial sums and merged: per-thread shards of RunStats give the same total, bit for bit,
+ * for any number of threads. Each value is truncated to a multiple of 2^-FRACTION_BITS when it is added.
+*/
+class FixedPointSum
+{
+public:
+    /** Number of bits after the binary point */
+    static const int FRACTION_BITS = 62;
+
+    /* Constructor creates a zero sum */
+    FixedPointSum();
+
+    /* Functions to add a value or another sum, and to read the total */
+    void clear();
+    void add(double value);
+    void add(const FixedPointSum &other);
+    double getValue() const;
+private:
+    /** The whole part of the sum */
+    long long whole;
+    /** The fraction part of the sum in units of 2^-FRACTION_BITS, always in [0, 2^FRACTION_BITS) between calls */
+    long long fraction;
+
+    /* Function to carry the overflow of the fraction part into the whole part */
+    void normalize();
+};
+
+/** \brief Constructor creates a zero sum */
+inline FixedPointSum::FixedPointSum() {
+    clear();
+} /* end Constructor */
+
+/** \brief clear resets the sum to zero */
+inline void FixedPointSum::clear() {
+    whole = 0;
+    fraction = 0;
+} /* end clear */
+
+/** \brief add adds a value to the sum; the value must be finite and less than 2^63 in magnitude
+ * \param value the value to add
+*/
+inline void FixedPointSum::add(double value) {
+    /* value - floor(value) is exact in double precision, and scaling it by a power of two is too */
+    double wholePart = floor(value);
+    whole += (long long) wholePart;
+    fraction += (long long) ldexp(value - wholePart, FRACTION_BITS);
+    normalize();
+} /* end add */
+
+/** \brief add adds another sum, e.g. that of a per-thread shard, to this one
+ * \param other the sum to add
+*/
+inline void FixedPointSum::add(const FixedPointSum &other) {
+    whole += other.whole;
+    fraction += other.fraction;
+    normalize();
+} /* end add */
+
+/** \brief getValue returns the sum rounded to a double */
+inline double FixedPointSum::getValue() const {
+    return (double) whole + ldexp((double) fraction, -FRACTION_BITS);
+} /* end getValue */
+
+/** \brief normalize moves whole units out of the fraction part; both parts are below 2^FRACTION_BITS before an add, so the fraction cannot overflow */
+inline void FixedPointSum::normalize() {
+    whole += fraction >> FRACTION_BITS;
+    fraction &= (1LL << FRACTION_BITS) - 1;
+} /* end normalize */
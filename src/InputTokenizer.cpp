@@ -0,0 +1,113 @@
+#include "include.h"
+
+/** \brief Constructor splits the contents into tokens and builds the label index in one pass
+ * \param contents the full text of the input file; tokens point into it, so it must outlive this InputTokenizer
+*/
+InputTokenizer::InputTokenizer(const string &contents) {
+    const char *text = contents.c_str();
+    size_t size = contents.size();
+    size_t pos = 0;
+    while (pos < size) {
+        while (pos < size && isspace((unsigned char) text[pos]))
+            pos++;
+        size_t start = pos;
+        while (pos < size && !isspace((unsigned char) text[pos]))
+            pos++;
+        if (pos > start) {
+            std::string_view token(text + start, pos - start);
+            labelIndex[token].push_back((int) tokens.size());
+            tokens.push_back(token);
+        }
+    }
+    searchPos = 0;
+    valuePos = 0;
+} /* end Constructor */
+
+/** \brief Destructor is empty, no cleanup required */
+InputTokenizer::~InputTokenizer(void) {
+
+} /* end Destructor */
+
+/** \brief skipPast moves to just after the next occurrence of label at or beyond the last label found
+ *
+ * If the label does not occur again, the search position is left unchanged so later labels are still found, but
+ * value reads fail until the next label is found
+ *
+ * \param label the token to search for
+ * \return true if the label was found
+*/
+bool InputTokenizer::skipPast(const char *label) {
+    unordered_map<std::string_view, vector<int>>::const_iterator entry = labelIndex.find(std::string_view(label));
+    if (entry != labelIndex.end()) {
+        const vector<int> &positions = entry->second;
+        vector<int>::const_iterator next = lower_bound(positions.begin(), positions.end(), searchPos);
+        if (next != positions.end()) {
+            searchPos = *next + 1;
+            valuePos = searchPos;
+            return true;
+        }
+    }
+    valuePos = (int) tokens.size();
+    return false;
+} /* end skipPast */
+
+/** \brief readInt parses the next token as an integer
+ * \param value set to the integer read; left unchanged if there is no token or it is not a number
+ * \return true if a value was read
+*/
+bool InputTokenizer::readInt(int &value) {
+    if (valuePos >= tokens.size())
+        return false;
+    const char *start = tokens[valuePos].data();
+    char *end;
+    long parsed = strtol(start, &end, 10);
+    if (end == start)
+        return false;
+    value = (int) parsed;
+    valuePos++;
+    searchPos = max(searchPos, valuePos);
+    return true;
+} /* end readInt */
+
+/** \brief readInt parses the next token as an integer flag, any nonzero value being true
+ * \param value set to the flag read; left unchanged if there is no token or it is not a number
+ * \return true if a value was read
+*/
+bool InputTokenizer::readInt(bool &value) {
+    int parsed;
+    if (!readInt(parsed))
+        return false;
+    value = (parsed != 0);
+    return true;
+} /* end readInt */
+
+/** \brief readDouble parses the next token as a floating point number
+ * \param value set to the number read; left unchanged if there is no token or it is not a number
+ * \return true if a value was read
+*/
+bool InputTokenizer::readDouble(double &value) {
+    if (valuePos >= tokens.size())
+        return false;
+    const char *start = tokens[valuePos].data();
+    char *end;
+    double parsed = strtod(start, &end);
+    if (end == start)
+        return false;
+    value = parsed;
+    valuePos++;
+    searchPos = max(searchPos, valuePos);
+    return true;
+} /* end readDouble */
+
+/** \brief readString reads the next token as a string
+ * \param value set to the token read; left unchanged if there is no token
+ * \return true if a value was read
+*/
+bool InputTokenizer::readString(string &value) {
+    if (valuePos >= tokens.size())
+        return false;
+    value.assign(tokens[valuePos].data(), tokens[valuePos].size());
+    valuePos++;
+    searchPos = max(searchPos, valuePos);
+    return true;
+} /* end readString */
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The InputTokenizer class splits the text of an input file into whitespace separated tokens in a single pass and
+ * indexes every token by its text, so SimContext can skip to the next occurrence of a label with a lookup instead of
+ * scanning the file token by token
+*/
+class InputTokenizer
+{
+public:
+    /* Constructor tokenizes and indexes the given file contents, which must outlive the tokenizer */
+    InputTokenizer(const string &contents);
+    ~InputTokenizer(void);
+
+    /* Functions to skip past the next occurrence of a label and read the values that follow it */
+    bool skipPast(const char *label);
+    bool readInt(int &value);
+    bool readInt(bool &value);
+    bool readDouble(double &value);
+    bool readString(string &value);
+private:
+    /** The text of each token, pointing into the file contents */
+    vector<std::string_view> tokens;
+    /** The positions in tokens at which each distinct token text occurs, in increasing order */
+    unordered_map<std::string_view, vector<int>> labelIndex;
+    /** Position that the next label search starts from: just past the last label found */
+    int searchPos;
+    /** Position of the next value to read; parked at the end after a missing label so its values are not misread */
+    int valuePos;
+};
@@ -19,13 +19,19 @@ void MaternalBiologyUpdater::performInitialization() {
         weeksLowAvidity = 0;
     }
     */
+    // Schedule the transitions still to come of an infection before the simulation start
+    scheduleMaternalBiologyEvents();
 }
 
-/** \brief performWeeklyUpdates performs all of the state and statistics updates for a simulated week of pregnancy */
+/** \brief performWeeklyUpdates performs all of the state and statistics updates for a simulated week of pregnancy.
+ * The transitions are scheduled on the timer wheel when the infection occurs, so a week with none due returns at once */
 void MaternalBiologyUpdater::performWeeklyUpdates() {
-    int week = patient->getGeneralState()->weekNum;
+    unsigned char dueEvents = popMaternalBiologyEvents();
+    if (dueEvents == 0) {
+        return;
+    }
     /** 1 week after infection */
-    if (week - patient->getMaternalDiseaseState()->weekLastCMV == patient->getMaternalDiseaseState()->weeksToViremiaFromInfection) {
+    if (dueEvents & (1 << EVENT_VIREMIA_START)) {
         // set mother to be viremic 
         setViremia(true);
         setPCRWouldBePositive(true);
@@ -34,7 +40,7 @@ void MaternalBiologyUpdater::performWeeklyUpdates() {
         }
     }
     /** 2 weeks after infection */
-    if (week - patient->getMaternalDiseaseState()->weekLastCMV == patient->getMaternalDiseaseState()->weeksToIgmPositiveFromInfection) {
+    if (dueEvents & (1 << EVENT_IGM_POSITIVE)) {
         // Set maternal IgM to positive
         if (patient->getMaternalMonitoringState()->IgMStatus == false) {
             setMaternalIgM(true);
@@ -44,7 +50,7 @@ void MaternalBiologyUpdater::performWeeklyUpdates() {
         }
     }
     /** 3 weeks after infection */
-    if (week - patient->getMaternalDiseaseState()->weekLastCMV == patient->getMaternalDiseaseState()->weeksToIggPositiveFromInfection) {
+    if (dueEvents & (1 << EVENT_IGG_POSITIVE)) {
         // Set maternal IgG to positive
         if (patient->getMaternalMonitoringState()->IgGStatus == false) {
             setMaternalIgG(true);
@@ -58,7 +64,7 @@ void MaternalBiologyUpdater::performWeeklyUpdates() {
         }
     }
     /** 4 weeks after infection */
-    if (week - patient->getMaternalDiseaseState()->weekLastCMV == (patient->getMaternalDiseaseState()->weeksToViremiaFromInfection + patient->getMaternalDiseaseState()->lengthOfViremia)) {
+    if (dueEvents & (1 << EVENT_VIREMIA_END)) {
         // Set mother to no longer be viremic and PCR Would Be Positive to false
         setMaternalCMVSymptoms(false);
         setViremia(false);
@@ -69,17 +75,24 @@ void MaternalBiologyUpdater::performWeeklyUpdates() {
 
     }
     /** 2 - 4 weeks after low avidity SHOULD BE MONTHS */
-    if (week - patient->getMaternalDiseaseState()->weekLastCMV == patient->getMaternalDiseaseState()->weeksToLowAvidityFromInfection + patient->getMaternalDiseaseState()->weeksToHighAvidityFromLowAvidity) {
+    if (dueEvents & (1 << EVENT_HIGH_AVIDITY)) {
         setMaternalAvidity(SimContext::HIGH_AVIDITY);
         if (patient->getGeneralState()->tracingEnabled) {
             tracer->printTrace(1, "High Avidity\n");
         }
     }
     /** 12 months (52 weeks) after infection */
-    if (week - patient->getMaternalDiseaseState()->weekLastCMV == (patient->getMaternalDiseaseState()->weeksToIgmPositiveFromInfection + patient->getMaternalDiseaseState()->lengthOfIgmPositivity)) {
+    if (dueEvents & (1 << EVENT_IGM_NEGATIVE)) {
         setMaternalIgM(false);
         if (patient->getGeneralState()->tracingEnabled) {
             tracer->printTrace(1, "IgM no longer positive\n");
         }
     }
-}
\ No newline at end of file
+}
+
+/** \brief hasEventInWeek returns whether any of the transitions of performWeeklyUpdates falls on the given week, whether
+ * or not it would change the mother's state; the week must lie within one turn of the timer wheel from the current one */
+bool MaternalBiologyUpdater::hasEventInWeek(int week) {
+    int slot = week & (BIOLOGY_WHEEL_SIZE - 1);
+    return patient->getMaternalDiseaseState()->biologyEventWheel[slot] != 0;
+}
@@ -17,6 +17,14 @@ public:
     void performInitialization();
     /* peformWeeklyUpdates perform all of the state and statistics updates for a simulated week DURING pregnancy */
     void performWeeklyUpdates();
+    /* hasEventInWeek returns whether any of the transitions of performWeeklyUpdates falls on the given week */
+    bool hasEventInWeek(int week);
+
+    /* Transitions scheduled on the maternal biology timer wheel, in the order they are applied within a week */
+    enum BIOLOGY_EVENT {EVENT_VIREMIA_START, EVENT_IGM_POSITIVE, EVENT_IGG_POSITIVE, EVENT_VIREMIA_END, EVENT_HIGH_AVIDITY, EVENT_IGM_NEGATIVE};
+    static const int NUM_BIOLOGY_EVENTS = 6;
+    /* Number of weekly slots on the timer wheel; a power of two longer than any pregnancy */
+    static const int BIOLOGY_WHEEL_SIZE = 64;
 
     /* WEEKS AFTER INFECTION */
     static const int WEEK_PCR_POSITIVE = 1;
@@ -19,8 +19,35 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
         beginWeekUpdater(this),
         endWeekUpdater(this)
 {
+    reset(patientNum, trace);
+}
+
+/** \brief reset restores this Patient to the initial state of a new patient with the given number, drawing its
+ * characteristics afresh. The cohort loop reuses one Patient per thread this way; the state vectors and test
+ * schedules are cleared rather than freed, so they keep their capacity from one patient to the next.
+ *
+ * \param patientNum the number of the patient, which also keys its random number stream
+ * \param trace whether the patient is traced (tracing is currently determined by RunSpecs numberOfPatientsToTrace)
+ */
+void Patient::reset(int patientNum, bool trace) {
     double randNum;
+    /* Restore every state field to zero before the explicit initial values below, so nothing carries over from the last patient */
+    this->generalState.prenatalTestsToPerformThisWeek.clear();
+    this->generalState.pendingFollowUpTests.clear();
+    this->generalState.pendingConfirmatoryTests.clear();
+    this->generalState.specialCaseTests.clear();
+    this->generalState.prenatalTestResultReturn.clear();
+    this->maternalState = MaternalState();
+    this->maternalDiseaseState = MaternalDiseaseState();
+    this->maternalMonitoringState = MaternalMonitoringState();
+    this->childState = ChildState();
+    this->childDiseaseState = ChildDiseaseState();
+    this->childMonitoringState = ChildMonitoringState();
+
     this->generalState.patientNum = patientNum;
+    for (int i = 0; i < NUM_LEAP_ROLLS; i++) {
+        this->presetRolls[i] = -1;
+    }
     //Reset seed for patient if using fixed seed
     CmvUtil::setFixedSeed(this);
     this->generalState.tracingEnabled = false;
@@ -30,12 +57,14 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
     this->generalState.weekNum = 0; // initial week number is set to 0
     this->generalState.discountFactor = 1.0;
     this->generalState.prenatalTestID = 0;
+    this->generalState.importanceWeight = 1.0;
 
     if (patientNum < simContext->getRunSpecsInputs()->numberOfPatientsToTrace) {
         this->generalState.tracingEnabled = true;
     }
     this->generalState.monthNum = 0;
     this->generalState.weekNum = 0; 
+    this->generalState.trimester = CmvUtil::getTrimester(this);
 
     /* FINISH setting discount factor */
     
@@ -55,6 +84,7 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
         this->generalState.prenatalTestsLastResult[i] = 0; // initialize all last test results to 0 (negative or none)
         this->generalState.weekTestLastPerformed[i] = -1000; // initialize week that test was last performed to -1000 so that it's effectively never occurred before
     }
+    this->generalState.numPrenatalTestsPerformed = 0;
     this->generalState.prenatalAppointmentThisWeek = false;
 
     /* set maternal life status */
@@ -99,70 +129,46 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
 
     /* SETTING MATERNAL DISEASE STATES */
 
-    /** Drawing for Maternal Biology Timing Characteristics */
+    /** Drawing for Maternal Biology Timing Characteristics: each is a normal draw conditioned on (int)(x + 0.5) being
+     * non-negative, i.e. on x > -1.5, drawn from the truncated normal in one random number per timing */
     // Drawing for Time to Viremia from Infection */
-    this->maternalDiseaseState.weeksToViremiaFromInfection = -1;
     int weeksToViremiaFromInfectionMean = simContext->getPrenatalNatHistInputs()->weeksToViremiaFromInfectionMean;
     int weeksToViremiaFromInfectionStdDev = simContext->getPrenatalNatHistInputs()->weeksToViremiaFromInfectionStdDev;
-    while(this->maternalDiseaseState.weeksToViremiaFromInfection < 0) {
-        this->maternalDiseaseState.weeksToViremiaFromInfection = (int)(CmvUtil::getRandomGaussian(weeksToViremiaFromInfectionMean, weeksToViremiaFromInfectionStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.weeksToViremiaFromInfection = max((int)(CmvUtil::getRandomTruncatedGaussian(weeksToViremiaFromInfectionMean, weeksToViremiaFromInfectionStdDev, -1.5) + 0.5), 0);
     // Drawing for Length of Viremia
-    this->maternalDiseaseState.lengthOfViremia = -1;
     int lengthOfViremiaMean = simContext->getPrenatalNatHistInputs()->lengthOfViremiaMean;
     int lengthOfViremiaStdDev = simContext->getPrenatalNatHistInputs()->lengthOfViremiaStdDev;
-    while(this->maternalDiseaseState.lengthOfViremia < 0) {
-        this->maternalDiseaseState.lengthOfViremia = (int)(CmvUtil::getRandomGaussian(lengthOfViremiaMean, lengthOfViremiaStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.lengthOfViremia = max((int)(CmvUtil::getRandomTruncatedGaussian(lengthOfViremiaMean, lengthOfViremiaStdDev, -1.5) + 0.5), 0);
     // Drawing for Time to IgM Positive From Infection
-    this->maternalDiseaseState.weeksToIgmPositiveFromInfection = -1;
     int weeksToIgmPositiveFromInfectionMean = simContext->getPrenatalNatHistInputs()->weeksToIgmPositiveFromInfectionMean;
     int weeksToIgmPositiveFromInfectionStdDev = simContext->getPrenatalNatHistInputs()->weeksToIgmPositiveFromInfectionStdDev;
-    while(this->maternalDiseaseState.weeksToIgmPositiveFromInfection < 0) {
-        this->maternalDiseaseState.weeksToIgmPositiveFromInfection = (int)(CmvUtil::getRandomGaussian(weeksToIgmPositiveFromInfectionMean, weeksToIgmPositiveFromInfectionStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.weeksToIgmPositiveFromInfection = max((int)(CmvUtil::getRandomTruncatedGaussian(weeksToIgmPositiveFromInfectionMean, weeksToIgmPositiveFromInfectionStdDev, -1.5) + 0.5), 0);
     // Drawing for Length of IgM positivity
-    this->maternalDiseaseState.lengthOfIgmPositivity = -1;
     int lengthOfIgmPositivityMean = simContext->getPrenatalNatHistInputs()->lengthOfIgmPositivityMean;
     int lengthOfIgmPositivityStdDev = simContext->getPrenatalNatHistInputs()->lengthOfIgmPositivityStdDev;
-    while(this->maternalDiseaseState.lengthOfIgmPositivity < 0) {
-        this->maternalDiseaseState.lengthOfIgmPositivity = (int)(CmvUtil::getRandomGaussian(lengthOfIgmPositivityMean, lengthOfIgmPositivityStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.lengthOfIgmPositivity = max((int)(CmvUtil::getRandomTruncatedGaussian(lengthOfIgmPositivityMean, lengthOfIgmPositivityStdDev, -1.5) + 0.5), 0);
     // Drawing for Time To IgG Positive From Infection 
-    this->maternalDiseaseState.weeksToIggPositiveFromInfection = -1;
     int weeksToIggPositiveFromInfectionMean = simContext->getPrenatalNatHistInputs()->weeksToIggPositiveFromInfectionMean;
     int weeksToIggPositiveFromInfectionStdDev = simContext->getPrenatalNatHistInputs()->weeksToIggPositiveFromInfectionStdDev;
-    while(this->maternalDiseaseState.weeksToIggPositiveFromInfection < 0) {
-        this->maternalDiseaseState.weeksToIggPositiveFromInfection = (int)(CmvUtil::getRandomGaussian(weeksToIggPositiveFromInfectionMean, weeksToIggPositiveFromInfectionStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.weeksToIggPositiveFromInfection = max((int)(CmvUtil::getRandomTruncatedGaussian(weeksToIggPositiveFromInfectionMean, weeksToIggPositiveFromInfectionStdDev, -1.5) + 0.5), 0);
     // Drawing for Time To Low Avidity From Infection
-    this->maternalDiseaseState.weeksToLowAvidityFromInfection = -1;
     int weeksToLowAvidityFromInfectionMean = simContext->getPrenatalNatHistInputs()->weeksToLowAvidityFromInfectionMean;
     int weeksToLowAvidityFromInfectionStdDev = simContext->getPrenatalNatHistInputs()->weeksToLowAvidityFromInfectionStdDev;
-    while(this->maternalDiseaseState.weeksToLowAvidityFromInfection < 0) {
-        this->maternalDiseaseState.weeksToLowAvidityFromInfection = (int)(CmvUtil::getRandomGaussian(weeksToLowAvidityFromInfectionMean, weeksToLowAvidityFromInfectionStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.weeksToLowAvidityFromInfection = max((int)(CmvUtil::getRandomTruncatedGaussian(weeksToLowAvidityFromInfectionMean, weeksToLowAvidityFromInfectionStdDev, -1.5) + 0.5), 0);
     // Drawing for Time To High Avidity From Low Avidity
-    this->maternalDiseaseState.weeksToHighAvidityFromLowAvidity = -1;
     int weeksToHighAvidityFromLowAvidityMean = simContext->getPrenatalNatHistInputs()->weeksToHighAvidityFromLowAvidityMean;
     int weeksToHighAvidityFromLowAvidityStdDev = simContext->getPrenatalNatHistInputs()->weeksToHighAvidityFromLowAvidityStdDev;
-    while(this->maternalDiseaseState.weeksToHighAvidityFromLowAvidity < 0) {
-        this->maternalDiseaseState.weeksToHighAvidityFromLowAvidity = (int)(CmvUtil::getRandomGaussian(weeksToHighAvidityFromLowAvidityMean, weeksToHighAvidityFromLowAvidityStdDev) + 0.5);
-    }
+    this->maternalDiseaseState.weeksToHighAvidityFromLowAvidity = max((int)(CmvUtil::getRandomTruncatedGaussian(weeksToHighAvidityFromLowAvidityMean, weeksToHighAvidityFromLowAvidityStdDev, -1.5) + 0.5), 0);
 
     // Setting CMV active status and timing of last active infection (if any)
     this->maternalDiseaseState.activeCMV = false;
     double probPrevCMVCase = 1-simContext->getCohortInputs()->lastGotActiveCMVByStrata[SimContext::NEVER_CMV];
-    vector<double> lastActiveCMV(SimContext::NUM_LAST_CMV_STRATA + 1, 0);
-
-    for (int j = 0; j < SimContext::NUM_LAST_CMV_STRATA + 1; j++) {
-        lastActiveCMV[j] = simContext->getCohortInputs()->lastGotActiveCMVByStrata[j];
-    }
 
     // setting maternal biology stats. If previous CMV, some of these will be changed in the next code block
     this->maternalDiseaseState.hadCMVDuringSim = false;
     this->maternalDiseaseState.activeCMV = false;
     this->maternalDiseaseState.viremia = false;
+    this->maternalDiseaseState.PCRWouldBePositive = false;
     this->maternalDiseaseState.IgG = false; // need to roll for initial positive?
     this->maternalDiseaseState.IgM = false; // need to roll for initial positive?
     this->maternalDiseaseState.avidity = SimContext::NO_AVIDITY;
@@ -175,7 +181,7 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
     
     /** Rolling for previous CMV infection (pre simulation) and setting maternal biology characteristics for patient at model start. */
     randNum = CmvUtil::getRandomDouble();
-    int prevCMVStratum = CmvUtil::selectFromDist(lastActiveCMV, randNum);
+    int prevCMVStratum = simContext->getCohortInputs()->lastGotActiveCMVDist.sample(randNum);
 
     this->maternalDiseaseState.prevCMVStratum = prevCMVStratum;
     if (prevCMVStratum != simContext->NEVER_CMV) { // If any previous CMV before, set the proper patient disease state characteristics
@@ -206,6 +212,7 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
         // Setting Viremia at start of patient simulation (if viremic)
         if (weeksFromPrevInfectionAtStart >= this->maternalDiseaseState.weeksToViremiaFromInfection && weeksFromPrevInfectionAtStart < this->maternalDiseaseState.lengthOfViremia) {
             this->maternalDiseaseState.viremia = true;
+            this->maternalDiseaseState.PCRWouldBePositive = true;
         }
         // Setting IgM at start of patient simulation (if IgM is positive)
         if (weeksFromPrevInfectionAtStart >= this->maternalDiseaseState.weeksToIgmPositiveFromInfection && weeksFromPrevInfectionAtStart < this->maternalDiseaseState.lengthOfIgmPositivity) {
@@ -280,8 +287,10 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
     this->maternalMonitoringState.weekCMVDiagnosed = -1; //set to -1 initially for not applicable
     this->maternalMonitoringState.monthCMVDetected = -1; //set to -1 initially for not applicable
     this->maternalMonitoringState.mildIllnessSymptoms = false;
+    this->maternalMonitoringState.viremiaStatus = false;
     this->maternalMonitoringState.IgMStatus = false;
     this->maternalMonitoringState.IgGStatus = false;
+    this->maternalMonitoringState.avidity = SimContext::NO_AVIDITY;
     this->maternalMonitoringState.CMVSymptoms = false;
     this->maternalMonitoringState.numRegularAppointments = 0; // initializing number of appointments to 0
     this->maternalMonitoringState.numMissedAppointments = 0; // initializing number of missed appointments to 0
@@ -332,20 +341,40 @@ Patient::Patient(SimContext *simContext, RunStats *runStats, CostStats *costStat
     beginWeekUpdater.performInitialization();
     endWeekUpdater.performInitialization();
     
-}
+} /* end reset */
 
 Patient::~Patient(void) {
 }
 
+/** Leap mode is off unless the --leap command line option is given */
+bool Patient::useLeapMode = false;
+
+/** Names of the weekly updaters, indexed by UPDATER_TYPE */
+const char *Patient::UPDATER_TYPE_NAMES[] = {
+    "BeginWeek", "CMVInfection", "MaternalBiology", "Pregnancy", "PrenatalTest", "EndWeek"
+};
+
 /** simulateWeek runs a single week of simulation for this patient, and updates
  * its state and runStats statistics.
+ * \param updaterTimings if not NULL, the time spent in each updater this week is added to it
 */
-void Patient::simulateWeek() {
+void Patient::simulateWeek(UpdaterTimings *updaterTimings) {
+    chrono::steady_clock::time_point lapTime;
+    if (updaterTimings != NULL) {
+        lapTime = chrono::steady_clock::now();
+    }
+    if (useLeapMode) {
+        leapQuietWeeks();
+    }
     /* Disease and General Health updaters called */
     beginWeekUpdater.performWeeklyUpdates();
+    lapUpdater(updaterTimings, UPDATER_BEGIN_WEEK, lapTime);
     cmvInfectionUpdater.performWeeklyUpdates();
+    lapUpdater(updaterTimings, UPDATER_CMV_INFECTION, lapTime);
     maternalBiologyUpdater.performWeeklyUpdates();
+    lapUpdater(updaterTimings, UPDATER_MATERNAL_BIOLOGY, lapTime);
     pregnancyUpdater.performWeeklyUpdates();
+    lapUpdater(updaterTimings, UPDATER_PREGNANCY, lapTime);
     /* Making sure that birth takes place after 41 weeks at maximum */
     if (generalState.weekNum == 41) {
         childState.deliveryOcurred = true;
@@ -353,9 +382,142 @@ void Patient::simulateWeek() {
     // only continue with the other weekly updaters if the child is not born yet and is still alive this week (after rolling for miscarriage/birth/continuation)
     if (this->childState.isAlive && !this->childState.deliveryOcurred) {
         prenatalTestUpdater.performWeeklyUpdates();
+        lapUpdater(updaterTimings, UPDATER_PRENATAL_TEST, lapTime);
         endWeekUpdater.performWeeklyUpdates();
     }
     else {
         endWeekUpdater.performEndPatientUpdates();
     }
-}
\ No newline at end of file
+    lapUpdater(updaterTimings, UPDATER_END_WEEK, lapTime);
+}
+
+/** \brief lapUpdater adds the time since lapTime to an updater's timing and restarts lapTime; does nothing if updaterTimings is NULL
+ * \param updaterTimings the timings to add to, or NULL when the week is not being timed
+ * \param updaterType the updater that just finished
+ * \param lapTime the time the updater started, set to the current time
+*/
+void Patient::lapUpdater(UpdaterTimings *updaterTimings, UPDATER_TYPE updaterType, chrono::steady_clock::time_point &lapTime) {
+    if (updaterTimings == NULL) {
+        return;
+    }
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    updaterTimings->nanoseconds[updaterType] += chrono::duration_cast<chrono::nanoseconds>(now - lapTime).count();
+    updaterTimings->numCalls[updaterType]++;
+    lapTime = now;
+} /* end lapUpdater */
+
+/** \brief canLeap returns whether the patient's state leaves nothing to happen in a week but the weekly rolls for maternal
+ * infection, mild illness and the end of pregnancy, apart from the scheduled events checked week by week in isQuietWeek.
+ * Traced patients and importance-sampled runs are always simulated week by week, and so are runs with common random
+ * numbers: whether a week is quiet depends on the testing schedule, so leaping would let scenarios that differ only in
+ * testing draw different natural histories.
+*/
+bool Patient::canLeap() {
+    if (generalState.tracingEnabled || simContext->getRunSpecsInputs()->infectionBiasFactor != 1 || CmvUtil::useCommonRandomNumbers) {
+        return false;
+    }
+    if (!childState.isAlive || childState.deliveryOcurred) {
+        return false;
+    }
+    if (maternalDiseaseState.activeCMV || maternalDiseaseState.hadCMVDuringSim || maternalDiseaseState.mildIllness) {
+        return false;
+    }
+    return !generalState.onTreatment && endWeekUpdater.getTreatmentToStart() == EndWeekUpdater::NO_TREATMENT_TO_START;
+} /* end canLeap */
+
+/** \brief isQuietWeek returns whether the given week, the current one or one after it, has no scheduled event: no prenatal
+ * visit, test or result return, no maternal biology transition, no one-time vertical transmission, and is not the last
+ * week of pregnancy when birth is forced. Only valid while canLeap holds.
+*/
+bool Patient::isQuietWeek(int week) {
+    if (week >= SimContext::MAX_WEEKS_PREGNANT - 1) {
+        return false;
+    }
+    return !prenatalTestUpdater.hasTestingInWeek(week) && !maternalBiologyUpdater.hasEventInWeek(week) &&
+        !cmvInfectionUpdater.hasScheduledEventInWeek(week);
+} /* end isQuietWeek */
+
+/** \brief getQuietWeeksEnd returns the first week from the current one on that is not quiet, which is the current week if
+ * the patient cannot leap at all. Nothing in a run of quiet weeks changes the schedule, so the weeks ahead can be checked
+ * without simulating them.
+*/
+int Patient::getQuietWeeksEnd() {
+    int week = generalState.weekNum;
+    if (!canLeap()) {
+        return week;
+    }
+    while (isQuietWeek(week)) {
+        week++;
+    }
+    return week;
+} /* end getQuietWeeksEnd */
+
+/** \brief skipQuietWeeks advances the patient to the given week over quiet weeks in which no roll fired, crediting each
+ * to the weekly statistics as the updaters would credit an uneventful week
+ *
+ * \param week the week to advance to
+*/
+void Patient::skipQuietWeeks(int week) {
+    while (generalState.weekNum < week) {
+        pregnancyUpdater.performQuietWeekUpdates();
+        endWeekUpdater.performQuietWeekUpdates();
+    }
+} /* end skipQuietWeeks */
+
+/** \brief leapQuietWeeks skips ahead over the quiet weeks in which none of the weekly rolls fires, drawing the week of the
+ * next event with a single random number instead of rolling for every week
+ *
+ * In a quiet week the only things that can happen are maternal infection, mild illness and the end of pregnancy, with the
+ * probabilities the updaters would roll against. One uniform u is compared against the running probability that none of
+ * them has fired: each week that still lies above u is credited to the weekly statistics as the updaters would credit an
+ * uneventful week, and the first week that drops below u is the event week. Its rolls are preset conditioned on at least
+ * one firing, and simulateWeek then runs it through the updaters as usual. If a week with a scheduled event comes first,
+ * the leap ends there and that week is simulated normally.
+*/
+void Patient::leapQuietWeeks() {
+    if (!canLeap() || !isQuietWeek(generalState.weekNum)) {
+        return;
+    }
+    double randNum = CmvUtil::getRandomDouble();
+    double probNoEventSoFar = 1;
+    while (isQuietWeek(generalState.weekNum)) {
+        double probMaternalCMV;
+        double probMildIllness;
+        cmvInfectionUpdater.getQuietWeekProbs(probMaternalCMV, probMildIllness);
+        double probPregnancyEnds = pregnancyUpdater.getProbPregnancyEnds();
+        double probNoEvent = (1 - probMaternalCMV) * (1 - probMildIllness) * (1 - probPregnancyEnds);
+        if (randNum >= probNoEventSoFar * probNoEvent) {
+            presetEventWeekRolls(probMaternalCMV, probMildIllness, probPregnancyEnds);
+            return;
+        }
+        probNoEventSoFar *= probNoEvent;
+        pregnancyUpdater.performQuietWeekUpdates();
+        endWeekUpdater.performQuietWeekUpdates();
+    }
+} /* end leapQuietWeeks */
+
+/** \brief presetEventWeekRolls draws this week's rolls conditioned on at least one of them firing
+ *
+ * The rolls are drawn in the order the updaters make them. Maternal infection fires with probability p/P(any); if it
+ * does, the other rolls are unconditioned (and the pregnancy outcome is then drawn for an infected mother). Otherwise mild
+ * illness fires with its probability given that it or the end of pregnancy does, and if it does not the pregnancy must
+ * end. Each preset random number lies in the slice of [0,1) of the outcome drawn, uniformly within the end of pregnancy
+ * so that the pregnancy updater's draw between miscarriage and birth is unchanged.
+ *
+ * \param probMaternalCMV the probability of maternal infection this week
+ * \param probMildIllness the probability of mild illness this week
+ * \param probPregnancyEnds the probability of miscarriage or birth this week
+*/
+void Patient::presetEventWeekRolls(double probMaternalCMV, double probMildIllness, double probPregnancyEnds) {
+    double probAnyEvent = 1 - (1 - probMaternalCMV) * (1 - probMildIllness) * (1 - probPregnancyEnds);
+    presetRolls[LEAP_ROLL_MATERNAL_INFECTION] = CmvUtil::getRandomDouble() * probAnyEvent;
+    if (presetRolls[LEAP_ROLL_MATERNAL_INFECTION] < probMaternalCMV) {
+        return;
+    }
+    double probMildOrPregnancyEnds = 1 - (1 - probMildIllness) * (1 - probPregnancyEnds);
+    presetRolls[LEAP_ROLL_MILD_ILLNESS] = CmvUtil::getRandomDouble() * probMildOrPregnancyEnds;
+    if (presetRolls[LEAP_ROLL_MILD_ILLNESS] < probMildIllness) {
+        return;
+    }
+    presetRolls[LEAP_ROLL_PREGNANCY_OUTCOME] = CmvUtil::getRandomDouble() * probPregnancyEnds;
+} /* end presetEventWeekRolls */
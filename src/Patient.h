@@ -10,10 +10,35 @@ class Patient
 {
 public:
     friend class StateUpdater;
+    friend class BatchEngine;
 
     Patient(SimContext *simContext, RunStats *runStats, CostStats *costStats, Tracer *tracer, int patientNum, bool trace);
     ~Patient(void);
 
+    /* reset reinitializes this object as a new patient, reusing its storage */
+    void reset(int patientNum, bool trace);
+
+    /** Indices of the weekly updaters, in the order simulateWeek calls them */
+    enum UPDATER_TYPE {UPDATER_BEGIN_WEEK, UPDATER_CMV_INFECTION, UPDATER_MATERNAL_BIOLOGY, UPDATER_PREGNANCY,
+        UPDATER_PRENATAL_TEST, UPDATER_END_WEEK};
+    static const int NUM_UPDATER_TYPES = 6;
+    static const char *UPDATER_TYPE_NAMES[];
+
+    /** The weekly rolls that leapQuietWeeks can preset for the week it stops at */
+    enum LEAP_ROLL {LEAP_ROLL_MATERNAL_INFECTION, LEAP_ROLL_MILD_ILLNESS, LEAP_ROLL_PREGNANCY_OUTCOME};
+    static const int NUM_LEAP_ROLLS = 3;
+    /** If true, simulateWeek first skips the quiet weeks ahead of the patient, see leapQuietWeeks; set by the --leap command line option */
+    static bool useLeapMode;
+
+    /** UpdaterTimings accumulates the time spent in each weekly updater over the weeks it is passed to simulateWeek */
+    class UpdaterTimings {
+    public:
+        /** Total nanoseconds spent in each updater */
+        long long nanoseconds[NUM_UPDATER_TYPES];
+        /** Number of times each updater was run */
+        long long numCalls[NUM_UPDATER_TYPES];
+    };
+
     /** GeneralState class holds information about the overall patient class, which includes both the mother and child. */
     class GeneralState {
     public:
@@ -43,20 +68,22 @@ public:
         int prenatalTestsLastResult[SimContext::NUM_PRENATAL_TESTS];
         /** Last week that prenatal test was performed (vector indexed by test number) */
         int weekTestLastPerformed[SimContext::NUM_PRENATAL_TESTS];
+        /** Number of prenatal tests performed on the mother-child pair so far, of any kind */
+        int numPrenatalTestsPerformed;
         /** Whether this week of pregnancy has an appointment for the patient */
         bool prenatalAppointmentThisWeek;
         /** Whether this week of pregnancy has an appointment triggered by symptomatic CMV or mild illness */
 
         /** This week's prenatal tests to perform */
         vector<SimContext::PrenatalTestInstance> prenatalTestsToPerformThisWeek;
-        /** Pending Follow-Up Prenatal Tests */
-        vector<SimContext::PrenatalTestInstance> pendingFollowUpTests[SimContext::MAX_WEEKS_PREGNANT];
-        /** Pending Confirmatory Prenatal Tests */
-        vector<SimContext::PrenatalTestInstance> pendingConfirmatoryTests[SimContext::MAX_WEEKS_PREGNANT];
-        /** Pending Special Case Tests */
-        vector<SimContext::PrenatalTestInstance> specialCaseTests[SimContext::MAX_WEEKS_PREGNANT];
-        /** Prenatal Test Result return array -- contains information about when prenatal tests are returned */
-        vector<SimContext::PrenatalTestInstance> prenatalTestResultReturn[SimContext::MAX_WEEKS_PREGNANT];
+        /** Pending Follow-Up Prenatal Tests, by week to test */
+        PrenatalTestSchedule pendingFollowUpTests;
+        /** Pending Confirmatory Prenatal Tests, by week to test */
+        PrenatalTestSchedule pendingConfirmatoryTests;
+        /** Pending Special Case Tests, by week to test */
+        PrenatalTestSchedule specialCaseTests;
+        /** Prenatal Test Result return schedule -- contains information about when prenatal tests are returned, by week to return */
+        PrenatalTestSchedule prenatalTestResultReturn;
         /** Whether patient/mother pair is on treatment */
         bool onTreatment;
         /** Treatment that the mother/pair is on */
@@ -65,6 +92,8 @@ public:
         int weekTreatmentStarted[SimContext::NUM_TREATMENTS];
         /** Treatments that the patient has had */
         bool hadTreatment[SimContext::NUM_TREATMENTS];
+        /** Likelihood ratio of the patient's history so far under the unbiased inputs to the importance-sampled one; 1 unless RunSpecs infectionBiasFactor is set */
+        double importanceWeight;
     };
 
     /** MaternalState class holds information about the mother's characteristics */
@@ -147,6 +176,9 @@ public:
         int weeksToLowAvidityFromInfection;
         /** Time To High Avidity From Low Avidity */
         int weeksToHighAvidityFromLowAvidity;
+        /** Timer wheel of the maternal biology transitions still due: bit e of slot (week % BIOLOGY_WHEEL_SIZE) is set if
+         * MaternalBiologyUpdater::BIOLOGY_EVENT e falls due that week */
+        unsigned char biologyEventWheel[MaternalBiologyUpdater::BIOLOGY_WHEEL_SIZE];
     };
 
     /** MaternalMonitoringState contains information for ther mother's testing, clinical visits, and observed health state */
@@ -287,8 +319,8 @@ public:
     const ChildMonitoringState *getChildMonitoringState();
 
     /* simulateWeek runs a single week of simulation for this patients, and updates
-        its state and runStats statistics*/
-    void simulateWeek();
+        its state and runStats statistics; if updaterTimings is given, the time spent in each updater is added to it */
+    void simulateWeek(UpdaterTimings *updaterTimings = NULL);
     /* simulateMonth runs a single month of simulation for this patients, and updates
         its state and runStats statistics*/
     void simulateMonth();
@@ -331,6 +363,19 @@ private:
     PrenatalTestUpdater prenatalTestUpdater;
     /** End Week Updater subclass object */
     EndWeekUpdater endWeekUpdater;
+    /** Random numbers preset by leapQuietWeeks for each LEAP_ROLL of the next week, -1 if the roll draws its own */
+    double presetRolls[NUM_LEAP_ROLLS];
+
+    /* Functions to skip ahead over the weeks in which none of the weekly rolls fires */
+    bool canLeap();
+    bool isQuietWeek(int week);
+    int getQuietWeeksEnd();
+    void skipQuietWeeks(int week);
+    void leapQuietWeeks();
+    void presetEventWeekRolls(double probMaternalCMV, double probMildIllness, double probPregnancyEnds);
+
+    /* lapUpdater adds the time since lapTime to an updater's timing and restarts lapTime */
+    static void lapUpdater(UpdaterTimings *updaterTimings, UPDATER_TYPE updaterType, chrono::steady_clock::time_point &lapTime);
 }; // end Patient
 
 /** getGeneralState returns a const pointer to the generalState object */
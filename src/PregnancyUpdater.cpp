@@ -22,23 +22,10 @@ void PregnancyUpdater::performWeeklyUpdates() {
     /* MISCARRIAGE/DELIVERY/CONTINUE PREGNANCY UPDATERS */
 
     /** Roll for spontaneous abortion/miscarriage/IUFD/Stillbirth, Delivery, or continue to next month */
-    double probMiscarriage = simContext->getPrenatalNatHistInputs()->backgroundMiscarriage[patient->getMaternalState()->maternalAgeYears][patient->getGeneralState()->weekNum];
-    double probDelivery = simContext->getCohortInputs()->weeklyProbBirth[patient->getMaternalState()->maternalAgeYears][patient->getGeneralState()->weekNum];
-    if (patient->getMaternalDiseaseState()->activeCMV) {
-        probMiscarriage = simContext->getPrenatalNatHistInputs()->CMVPositiveMiscarriage[patient->getMaternalState()->maternalAgeYears][patient->getGeneralState()->weekNum];
-        probDelivery = simContext->getCohortInputs()->CMVPositiveWeeklyProbBirth[patient->getMaternalState()->maternalAgeYears][patient->getGeneralState()->weekNum];
-    }
-    double probContinue = 1 - probMiscarriage - probDelivery;
-    if (probMiscarriage + probDelivery > 1) {
-        probDelivery = 1 - probMiscarriage;
-        probContinue = 0;
-        if ((probMiscarriage + probDelivery > 1) && patient->getGeneralState()->tracingEnabled) {
-            tracer->printTrace(1, "WARNING: Sum of probability of Miscarriage and Probability of Delivery greater than 1. May yield inaccurate results.\n");
-        }
-    }
-    vector<double> miscarriageOrDelivery = {probMiscarriage, probDelivery, probContinue};
-    randNum = CmvUtil::getRandomDouble();
-    int pregnancyContinuation = CmvUtil::selectFromDist(miscarriageOrDelivery, randNum);
+    int cmvStatus = patient->getMaternalDiseaseState()->activeCMV ? SimContext::CMV_POSITIVE : SimContext::CMV_NEGATIVE;
+    const DiscreteDist &miscarriageOrDelivery = simContext->getPrenatalNatHistInputs()->pregnancyOutcomeDist[patient->getMaternalState()->maternalAgeYears][patient->getGeneralState()->weekNum][cmvStatus];
+    randNum = getLeapRollRandomDouble(Patient::LEAP_ROLL_PREGNANCY_OUTCOME, CmvUtil::STREAM_PREGNANCY_OUTCOME);
+    int pregnancyContinuation = miscarriageOrDelivery.sample(randNum);
     /** if it's max week pregnant and "continue" is selected for, just make it birth because birth has to occur by week 41.*/
     if (pregnancyContinuation == CONTINUE && patient->getGeneralState()->weekNum == SimContext::MAX_WEEKS_PREGNANT - 1) {
         pregnancyContinuation = BIRTH;
@@ -73,7 +60,7 @@ void PregnancyUpdater::performWeeklyUpdates() {
         }
         else if (pregnancyContinuation == BIRTH) {
             // roll for death at birth
-            randNum = CmvUtil::getRandomDouble();
+            randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_PREGNANCY_OUTCOME);
             if (randNum < simContext->getPrenatalNatHistInputs()->fetalDeathRiskDuringBirth[patient->getGeneralState()->weekNum][patient->getChildDiseaseState()->hadCMV]) {
                 // baby dies during birth
                 if (patient->getGeneralState()->tracingEnabled) {
@@ -133,7 +120,7 @@ void PregnancyUpdater::performWeeklyUpdates() {
     }
     else if (pregnancyContinuation == BIRTH) {
         // roll for death at birth
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_PREGNANCY_OUTCOME);
         if (randNum < simContext->getPrenatalNatHistInputs()->fetalDeathRiskDuringBirth[patient->getGeneralState()->weekNum][patient->getChildDiseaseState()->hadCMV]) {
             // baby dies during birth
             if (patient->getGeneralState()->tracingEnabled) {
@@ -168,4 +155,27 @@ void PregnancyUpdater::performWeeklyUpdates() {
      */
     
     //continue pregnancy in all other cases (other than birth or miscarriage)
-}
\ No newline at end of file
+}
+
+/** \brief getProbPregnancyEnds returns the probability that this week's pregnancy roll selects miscarriage or birth for a
+ * mother without active CMV */
+double PregnancyUpdater::getProbPregnancyEnds() {
+    return getProbPregnancyEnds(simContext, patient->getMaternalState()->maternalAgeYears, patient->getGeneralState()->weekNum);
+}
+
+/** \brief getProbPregnancyEnds returns the probability that the pregnancy roll selects miscarriage or birth for a mother
+ * without active CMV of the given age in the given week; the two outcomes come before CONTINUE in the distribution
+ *
+ * \param simContext the inputs to look the probability up in
+ * \param maternalAgeYears the mother's age in whole years
+ * \param week the week of pregnancy
+*/
+double PregnancyUpdater::getProbPregnancyEnds(SimContext *simContext, int maternalAgeYears, int week) {
+    const DiscreteDist &miscarriageOrDelivery = simContext->getPrenatalNatHistInputs()->pregnancyOutcomeDist[maternalAgeYears][week][SimContext::CMV_NEGATIVE];
+    return miscarriageOrDelivery.getCumProb(BIRTH);
+}
+
+/** \brief performQuietWeekUpdates updates the statistics for a week skipped by Patient::leapQuietWeeks as performWeeklyUpdates does when the pregnancy continues */
+void PregnancyUpdater::performQuietWeekUpdates() {
+    incrementNumAliveFetuses();
+}
@@ -18,6 +18,10 @@ public:
     /* peformWeeklyUpdates perform all of the state and statistics updates for a simulated week DURING pregnancy */
     void performWeeklyUpdates();
 
+    /* Functions used by Patient::leapQuietWeeks and BatchEngine for a mother without active CMV */
+    double getProbPregnancyEnds();
+    static double getProbPregnancyEnds(SimContext *simContext, int maternalAgeYears, int week);
+    void performQuietWeekUpdates();
 
 private:
 
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The PrenatalTestSchedule class holds a patient's prenatal test instances bucketed by week of pregnancy. Each week is
+ * a linked list threaded through one pool of entries stored inline in the object, so scheduling and looking up tests
+ * does not allocate. Tests are only ever read for the current or a later week, so once the week advances the entries
+ * of the finished weeks are released and reused; only a patient with more than INLINE_CAPACITY tests pending at once
+ * spills into the overflow vector on the heap.
+*/
+class PrenatalTestSchedule
+{
+public:
+    /** Number of entries stored inline; comfortably above the most tests a patient has pending in one queue at once */
+    static const int INLINE_CAPACITY = 32;
+    /** Entry index marking the end of a week's list */
+    static const int NO_ENTRY = -1;
+
+    /* Constructor creates an empty schedule */
+    PrenatalTestSchedule();
+
+    /* Functions to schedule tests and release the entries of weeks that have passed */
+    void clear();
+    void push(const SimContext::PrenatalTestInstance &testInstance, int week);
+    void releaseWeeksBefore(int week);
+
+    /* Functions to look up the tests scheduled for a week, in the order they were pushed */
+    int size(int week) const;
+    int firstEntry(int week) const;
+    int nextEntry(int entry) const;
+    const SimContext::PrenatalTestInstance &getTest(int entry) const;
+    bool containsTestAssay(int week, int testAssay) const;
+    SimContext::PrenatalTestMask getTestAssays(int week) const;
+    void markPerformed(int week, int testID);
+private:
+    /** Entry is one scheduled test and the index of the next entry in its week's list (or the free list) */
+    struct Entry {
+        SimContext::PrenatalTestInstance testInstance;
+        int next;
+    };
+
+    /** The pool of entries, used first; entry indices at or beyond INLINE_CAPACITY refer to overflowEntries */
+    Entry inlineEntries[INLINE_CAPACITY];
+    /** Entries beyond the inline pool, only used when more than INLINE_CAPACITY tests are pending at once */
+    vector<Entry> overflowEntries;
+    /** The number of pool entries that have ever been used */
+    int numEntries;
+    /** The head of the list of released entries available for reuse */
+    int freeEntry;
+    /** The first and last entry and the number of entries in each week's list */
+    int firstInWeek[SimContext::MAX_WEEKS_PREGNANT];
+    int lastInWeek[SimContext::MAX_WEEKS_PREGNANT];
+    short numInWeek[SimContext::MAX_WEEKS_PREGNANT];
+    /** The assays of the tests in each week's list, bit i standing for prenatal test i */
+    SimContext::PrenatalTestMask assaysInWeek[SimContext::MAX_WEEKS_PREGNANT];
+    /** The earliest week whose entries have not been released */
+    int firstLiveWeek;
+
+    /* Functions to access an entry by index and to take an unused one */
+    Entry &getEntry(int entry);
+    const Entry &getEntry(int entry) const;
+    int allocateEntry();
+};
+
+/** \brief Constructor creates an empty schedule */
+inline PrenatalTestSchedule::PrenatalTestSchedule() {
+    clear();
+} /* end Constructor */
+
+/** \brief clear removes every scheduled test and makes the whole pool available again; the overflow vector keeps its capacity */
+inline void PrenatalTestSchedule::clear() {
+    overflowEntries.clear();
+    numEntries = 0;
+    freeEntry = NO_ENTRY;
+    for (int week = 0; week < SimContext::MAX_WEEKS_PREGNANT; week++) {
+        firstInWeek[week] = NO_ENTRY;
+        lastInWeek[week] = NO_ENTRY;
+        numInWeek[week] = 0;
+        assaysInWeek[week] = 0;
+    }
+    firstLiveWeek = 0;
+} /* end clear */
+
+/** \brief push adds a test to the end of a week's list
+ *
+ * Tests scheduled past the last week of pregnancy, or for a week that has already been released, can never be
+ * looked up and are dropped
+ *
+ * \param testInstance the test to schedule
+ * \param week the week of pregnancy to schedule it in
+*/
+inline void PrenatalTestSchedule::push(const SimContext::PrenatalTestInstance &testInstance, int week) {
+    if (week < firstLiveWeek || week >= SimContext::MAX_WEEKS_PREGNANT) {
+        return;
+    }
+    int entry = allocateEntry();
+    Entry &newEntry = getEntry(entry);
+    newEntry.testInstance = testInstance;
+    newEntry.next = NO_ENTRY;
+    if (lastInWeek[week] == NO_ENTRY) {
+        firstInWeek[week] = entry;
+    }
+    else {
+        getEntry(lastInWeek[week]).next = entry;
+    }
+    lastInWeek[week] = entry;
+    numInWeek[week]++;
+    assaysInWeek[week] |= (SimContext::PrenatalTestMask) (1 << testInstance.testAssay);
+} /* end push */
+
+/** \brief releaseWeeksBefore returns the entries of every week before the given one to the free list; those weeks must not be read again
+ * \param week the earliest week that is still live, normally the current week
+*/
+inline void PrenatalTestSchedule::releaseWeeksBefore(int week) {
+    week = min(week, SimContext::MAX_WEEKS_PREGNANT);
+    for (; firstLiveWeek < week; firstLiveWeek++) {
+        if (firstInWeek[firstLiveWeek] != NO_ENTRY) {
+            getEntry(lastInWeek[firstLiveWeek]).next = freeEntry;
+            freeEntry = firstInWeek[firstLiveWeek];
+            firstInWeek[firstLiveWeek] = NO_ENTRY;
+            lastInWeek[firstLiveWeek] = NO_ENTRY;
+            numInWeek[firstLiveWeek] = 0;
+            assaysInWeek[firstLiveWeek] = 0;
+        }
+    }
+} /* end releaseWeeksBefore */
+
+/** \brief size returns the number of tests scheduled for a week
+ * \param week the week of pregnancy
+*/
+inline int PrenatalTestSchedule::size(int week) const {
+    return numInWeek[week];
+} /* end size */
+
+/** \brief firstEntry returns the first entry of a week's list, or NO_ENTRY if nothing is scheduled that week
+ * \param week the week of pregnancy
+*/
+inline int PrenatalTestSchedule::firstEntry(int week) const {
+    return firstInWeek[week];
+} /* end firstEntry */
+
+/** \brief nextEntry returns the entry after the given one in its week's list, or NO_ENTRY at the end of the list
+ * \param entry an entry returned by firstEntry or nextEntry
+*/
+inline int PrenatalTestSchedule::nextEntry(int entry) const {
+    return getEntry(entry).next;
+} /* end nextEntry */
+
+/** \brief getTest returns the test stored in an entry; the reference is invalidated by the next push
+ * \param entry an entry returned by firstEntry or nextEntry
+*/
+inline const SimContext::PrenatalTestInstance &PrenatalTestSchedule::getTest(int entry) const {
+    return getEntry(entry).testInstance;
+} /* end getTest */
+
+/** \brief containsTestAssay returns whether any test of the given assay is scheduled for a week
+ * \param week the week of pregnancy
+ * \param testAssay the index of the prenatal test
+*/
+inline bool PrenatalTestSchedule::containsTestAssay(int week, int testAssay) const {
+    return (assaysInWeek[week] & (1 << testAssay)) != 0;
+} /* end containsTestAssay */
+
+/** \brief getTestAssays returns the set of assays of the tests scheduled for a week
+ * \param week the week of pregnancy
+*/
+inline SimContext::PrenatalTestMask PrenatalTestSchedule::getTestAssays(int week) const {
+    return assaysInWeek[week];
+} /* end getTestAssays */
+
+/** \brief markPerformed sets testPerformed on the test with the given ID in a week's list
+ * \param week the week of pregnancy the test is scheduled in
+ * \param testID the ID of the test instance
+*/
+inline void PrenatalTestSchedule::markPerformed(int week, int testID) {
+    if (week < firstLiveWeek || week >= SimContext::MAX_WEEKS_PREGNANT) {
+        return;
+    }
+    for (int entry = firstInWeek[week]; entry != NO_ENTRY; entry = getEntry(entry).next) {
+        if (getEntry(entry).testInstance.testID == testID) {
+            getEntry(entry).testInstance.testPerformed = true;
+        }
+    }
+} /* end markPerformed */
+
+/** \brief getEntry returns the pool entry with the given index */
+inline PrenatalTestSchedule::Entry &PrenatalTestSchedule::getEntry(int entry) {
+    if (entry < INLINE_CAPACITY) {
+        return inlineEntries[entry];
+    }
+    return overflowEntries[entry - INLINE_CAPACITY];
+} /* end getEntry */
+
+/** \brief getEntry returns the pool entry with the given index */
+inline const PrenatalTestSchedule::Entry &PrenatalTestSchedule::getEntry(int entry) const {
+    if (entry < INLINE_CAPACITY) {
+        return inlineEntries[entry];
+    }
+    return overflowEntries[entry - INLINE_CAPACITY];
+} /* end getEntry */
+
+/** \brief allocateEntry returns an unused entry: a released one if available, then the next unused inline one, and only then a new overflow entry */
+inline int PrenatalTestSchedule::allocateEntry() {
+    if (freeEntry != NO_ENTRY) {
+        int entry = freeEntry;
+        freeEntry = getEntry(entry).next;
+        return entry;
+    }
+    if (numEntries >= INLINE_CAPACITY) {
+        overflowEntries.push_back(Entry());
+    }
+    return numEntries++;
+} /* end allocateEntry */
@@ -15,6 +15,8 @@ PrenatalTestUpdater::~PrenatalTestUpdater(void) {
 
 void PrenatalTestUpdater::performInitialization() {
     StateUpdater::performInitialUpdates();
+    prenatalTestsToPerform.clear();
+    additionalTestsThisWeek.clear();
 }
 
 
@@ -26,7 +28,7 @@ PrenatalTestUpdater::PrenatalTestState::~PrenatalTestState(void) {
 
 // Initializing Prenatal Test State for Base Test
 
-SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalTestInstance(SimContext::PrenatalTestingInputs::PrenatalTest prenatalTest, int testID) {
+SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalTestInstance(const SimContext::PrenatalTestingInputs::PrenatalTest &prenatalTest, int testID) {
     double randNum;
     int testAssay = prenatalTest.testArray;
     int testType = SimContext::PN_TEST_BASE;
@@ -37,7 +39,7 @@ SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalTestInst
     bool testPerformed = false;
     bool result = false;
     bool returnToPatient = false;
-    randNum = CmvUtil::getRandomDouble();
+    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
     if (randNum < prenatalTest.probResultReturn) {
         returnToPatient = true;
     }
@@ -56,12 +58,12 @@ SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalTestInst
 
 
 // Initiatializing Prenatal Test State for Follow-up test
-SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalFollowUpState(SimContext::PrenatalTestingInputs::PrenatalTest prenatalTest, SimContext::PrenatalTestInstance testFollowingUpFrom, int weeksDelay, int testID) {
+SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalFollowUpState(const SimContext::PrenatalTestingInputs::PrenatalTest &prenatalTest, const SimContext::PrenatalTestInstance &testFollowingUpFrom, int weeksDelay, int testID) {
     
     int weekScheduled = patient->getGeneralState()->weekNum;
     int weekToTest = patient->getGeneralState()->weekNum + weeksDelay;
     bool returnToPatient = false;
-    double randNum = CmvUtil::getRandomDouble();
+    double randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
     if (randNum < prenatalTest.probResultReturn) {
         returnToPatient = true;
     }
@@ -73,7 +75,7 @@ SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalFollowUp
 }
 
 // Initializing Prenatal Test State for Confirmatory test
-SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalConfirmatoryState(SimContext::PrenatalTestingInputs::PrenatalTest prenatalTest, SimContext::PrenatalTestInstance testFollowingUpFrom, int weeksDelay, int testID) {
+SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalConfirmatoryState(const SimContext::PrenatalTestingInputs::PrenatalTest &prenatalTest, const SimContext::PrenatalTestInstance &testFollowingUpFrom, int weeksDelay, int testID) {
     int testAssay = prenatalTest.testArray;
     int testType = SimContext::PN_TEST_CONF;
     int confirmatoryNumber = testFollowingUpFrom.confirmatoryNumber + 1;
@@ -83,7 +85,7 @@ SimContext::PrenatalTestInstance PrenatalTestUpdater::initializePrenatalConfirma
     bool result = false;
     /** Rolling for whether to return the result to the patient */
     bool returnToPatient = false;
-    double randNum = CmvUtil::getRandomDouble();
+    double randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
     if (randNum < prenatalTest.probResultReturn) {
         returnToPatient = true;
     }
@@ -100,14 +102,13 @@ void PrenatalTestUpdater::performUpdates() {
 }
 
 
-/* determines whether there is a scheduled appointment this week*/
+/* determines whether there is a scheduled appointment in the given week*/
 
-bool PrenatalTestUpdater::determineIfScheduledVisit() {
+bool PrenatalTestUpdater::determineIfScheduledVisit(int weekNum) {
     bool visitThisWeek = false;
     int i;
     int interval;
     int timeBucketMin;
-    int weekNum = patient->getGeneralState()->weekNum;
     bool observedSymptomatic;
     int maternalInfectionCondition;
     
@@ -135,8 +136,19 @@ bool PrenatalTestUpdater::determineIfScheduledVisit() {
     return visitThisWeek;
 }
 
+/** \brief hasTestingInWeek returns whether performWeeklyUpdates has anything to do in the given week for a mother without
+ * symptoms or mild illness: a scheduled visit, a pending follow-up, confirmatory or special case test, or a result to return.
+ * Weeks after the current one are answered from the visits and tests scheduled so far */
+bool PrenatalTestUpdater::hasTestingInWeek(int weekNum) {
+    if (determineIfScheduledVisit(weekNum)) {
+        return true;
+    }
+    return patient->getGeneralState()->pendingFollowUpTests.size(weekNum) > 0 || patient->getGeneralState()->pendingConfirmatoryTests.size(weekNum) > 0 ||
+        patient->getGeneralState()->specialCaseTests.size(weekNum) > 0 || patient->getGeneralState()->prenatalTestResultReturn.size(weekNum) > 0;
+}
+
 /* determines if all tests this week have been performed */
-bool PrenatalTestUpdater::determineIfAllTestsPerformed(vector<SimContext::PrenatalTestInstance> testsThisWeek) {
+bool PrenatalTestUpdater::determineIfAllTestsPerformed(const vector<SimContext::PrenatalTestInstance> &testsThisWeek) {
     bool allTestsPerformed = true;
     for (int i = 0; i < testsThisWeek.size(); i++) {
         if (testsThisWeek[i].testPerformed == false) {
@@ -147,29 +159,32 @@ bool PrenatalTestUpdater::determineIfAllTestsPerformed(vector<SimContext::Prenat
 }
 
 
-vector<SimContext::PrenatalTestInstance> PrenatalTestUpdater::getTestsThisWeek() {
+void PrenatalTestUpdater::getTestsThisWeek(vector<SimContext::PrenatalTestInstance> &testsThisWeek) {
     int i;
     double randNum;
     int weekNum = patient->getGeneralState()->weekNum;
     bool scheduledVisit;
-    vector<SimContext::PrenatalTestInstance> testsThisWeek;
     testsThisWeek.clear();
+    /* Assays of the tests in testsThisWeek, and the tests that can be administered this week */
+    SimContext::PrenatalTestMask testsThisWeekMask = 0;
+    SimContext::PrenatalTestMask availableTests = simContext->getBackgroundScreeningInputs()->availableTestsMask[weekNum];
 
     /** FOLLOW-UP TESTS */
     // looping over all scheduled follow-up tests for this week. Add to testsThisWeek. 
-    for (i = 0; i < patient->getGeneralState()->pendingFollowUpTests[weekNum].size(); i++) {
-        SimContext::PrenatalTestInstance followUpTest = patient->getGeneralState()->pendingFollowUpTests[weekNum][i];
+    const PrenatalTestSchedule &pendingFollowUpTests = patient->getGeneralState()->pendingFollowUpTests;
+    for (int entry = pendingFollowUpTests.firstEntry(weekNum); entry != PrenatalTestSchedule::NO_ENTRY; entry = pendingFollowUpTests.nextEntry(entry)) {
+        const SimContext::PrenatalTestInstance &followUpTest = pendingFollowUpTests.getTest(entry);
         //Checking for tests that are scheduled for the current week
         if (followUpTest.weekToTest == patient->getGeneralState()->weekNum) {
             // if week num is within the weeks that the test is available, continue.
-            if (patient->getGeneralState()->weekNum >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[followUpTest.testAssay].availableStartingWeek &&
-            patient->getGeneralState()->weekNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[followUpTest.testAssay].notAvailableAfter) {
+            if (availableTests & (1 << followUpTest.testAssay)) {
                 // If weeks since test was last performed is greater than the test's minimum test interval, continue. Otherwise, don't.
                 if ((weekNum - patient->getGeneralState()->weekTestLastPerformed[followUpTest.testAssay]) >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[followUpTest.testAssay].minimumTestInterval) {
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_OFFER);
                     // Roll for whether test is given based on probability the test is offered and probability the test is performed. If yes, add to testsThisWeek vector.
                     if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[followUpTest.testAssay].probOfferedAndAccept) {
                         testsThisWeek.push_back(followUpTest);
+                        testsThisWeekMask |= (1 << followUpTest.testAssay);
                     }
                 }
             }
@@ -178,24 +193,25 @@ vector<SimContext::PrenatalTestInstance> PrenatalTestUpdater::getTestsThisWeek()
 
     /** CONFIRMATORY TESTS*/
     // looping over all scheduled confirmatory tests for this week. Add to testsThisWeek ONLY IF scheduled follow-up tests don't override them. 
-    for ( i = 0; i < patient->getGeneralState()->pendingConfirmatoryTests[weekNum].size(); i++) {
-        SimContext::PrenatalTestInstance confirmatoryTest = patient->getGeneralState()->pendingConfirmatoryTests[weekNum][i];
+    const PrenatalTestSchedule &pendingConfirmatoryTests = patient->getGeneralState()->pendingConfirmatoryTests;
+    for (int entry = pendingConfirmatoryTests.firstEntry(weekNum); entry != PrenatalTestSchedule::NO_ENTRY; entry = pendingConfirmatoryTests.nextEntry(entry)) {
+        const SimContext::PrenatalTestInstance &confirmatoryTest = pendingConfirmatoryTests.getTest(entry);
         // Checking for tests that are scheduled for the current week
         if (confirmatoryTest.weekToTest == patient->getGeneralState()->weekNum) {
             // if week num is within the weeks that the test is available, continue.
-            if (patient->getGeneralState()->weekNum >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[confirmatoryTest.testAssay].availableStartingWeek &&
-            patient->getGeneralState()->weekNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[confirmatoryTest.testAssay].notAvailableAfter) {
+            if (availableTests & (1 << confirmatoryTest.testAssay)) {
 
                 // Checking if test type is already in the pending Follow-Up test vectors. Only add the test to testsThisWeek if it's NOT already in the scheduled follow-up vector. 
-                if (!containsTestType(patient->getGeneralState()->pendingFollowUpTests[weekNum], confirmatoryTest)) {
+                if (!pendingFollowUpTests.containsTestAssay(weekNum, confirmatoryTest.testAssay)) {
                     // Checking if testsThisWeek already contains this test type
-                    if (!containsTestType(testsThisWeek, confirmatoryTest)) {
+                    if (!(testsThisWeekMask & (1 << confirmatoryTest.testAssay))) {
                         // If weeks since test was last performed is greater than the test's minimum test interval, continue. Otherwise, don't.
                         if ((patient->getGeneralState()->weekNum - patient->getGeneralState()->weekTestLastPerformed[confirmatoryTest.testAssay]) >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[confirmatoryTest.testAssay].minimumTestInterval) {
                             // Roll for whether test is given based on probability the test is offered and probability the test is performed. If yes, add to testsThisWeek vector.
-                            randNum = CmvUtil::getRandomDouble();
+                            randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_OFFER);
                             if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[confirmatoryTest.testAssay].probOfferedAndAccept) {
                                 testsThisWeek.push_back(confirmatoryTest);
+                                testsThisWeekMask |= (1 << confirmatoryTest.testAssay);
                             }
                         }
                     }
@@ -206,80 +222,53 @@ vector<SimContext::PrenatalTestInstance> PrenatalTestUpdater::getTestsThisWeek()
 
     /** SCHEDULED BASE TESTS */
     // Checking to see if there is a scheduled visit this week (base tests will only be done if there is a scheduled visit)
-    if (determineIfScheduledVisit()) {
-        // looping over all scheduled base tests, add to tests this week ONLY IF scheduled follow-up and confirmatory tests don't override them.
+    if (determineIfScheduledVisit(weekNum)) {
+        SimContext::PrenatalTestMask scheduledTests;
+        if (patient->getChildMonitoringState()->knownCMV) {
+            scheduledTests = simContext->getBackgroundScreeningInputs()->testingUponChildDiagnosisMask[weekNum][patient->getChildMonitoringState()->observedSymptomatic];
+        }
+        else if (patient->getMaternalMonitoringState()->knownCMV) {
+            scheduledTests = simContext->getBackgroundScreeningInputs()->testingUponMaternalDiagnosisMask[weekNum][patient->getMaternalMonitoringState()->diagnosedCMVStatus];
+        }
+        else {
+            scheduledTests = simContext->getBackgroundScreeningInputs()->backgroundTestingMask[weekNum];
+        }
+        // Only scheduled tests that are available this week, and not already in the pending follow-up and confirmatory test queues or in testsThisWeek, are candidates
+        SimContext::PrenatalTestMask candidateTests = scheduledTests & availableTests & ~testsThisWeekMask &
+            ~pendingFollowUpTests.getTestAssays(weekNum) & ~pendingConfirmatoryTests.getTestAssays(weekNum);
+        // looping over the candidate base tests in test order
         for (i = 0; i < SimContext::NUM_PRENATAL_TESTS; i++) {
-            bool scheduledTest;
-            if (patient->getChildMonitoringState()->knownCMV) {
-                scheduledTest = simContext->getBackgroundScreeningInputs()->testingUponChildDiagnosis[patient->getGeneralState()->weekNum][i][patient->getChildMonitoringState()->observedSymptomatic];
-            }
-            else if (patient->getMaternalMonitoringState()->knownCMV) {
-                scheduledTest = simContext->getBackgroundScreeningInputs()->testingUponMaternalDiagnosis[patient->getGeneralState()->weekNum][i][patient->getMaternalMonitoringState()->diagnosedCMVStatus];
-            }
-            else {
-                scheduledTest = simContext->getBackgroundScreeningInputs()->backgroundTesting[patient->getGeneralState()->weekNum][i];
-            }
-            
-            // Checking if test type is already in the pending Follow-Up and Confirmatory test vectors. Only add the test to testsThisWeek if it's NOT already in either of these vectors. 
-            if (!containsTestType(patient->getGeneralState()->pendingFollowUpTests[weekNum], i) && !containsTestType(patient->getGeneralState()->pendingConfirmatoryTests[weekNum], i)){
-                if (patient->getGeneralState()->weekNum >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i].availableStartingWeek &&
-                patient->getGeneralState()->weekNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i].notAvailableAfter) {
-                    // Checking if testsThisWeek already contains this test type
-                    if (!containsTestType(testsThisWeek, i)) {
-                        if (scheduledTest) {
-                            // If weeks since test was last performed is greater than the test's minimum test interval, continue. Otherwise, don't.
-                            if ((patient->getGeneralState()->weekNum - patient->getGeneralState()->weekTestLastPerformed[i]) >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i].minimumTestInterval) {
-                                // Roll for whether test is given based on probability the test is offered and probability the test is performed.
-                                randNum = CmvUtil::getRandomDouble();
-                                if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i].probOfferedAndAccept) {
-                                    SimContext::PrenatalTestInstance scheduledTestState = initializePrenatalTestInstance(simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i], patient->getGeneralState()->prenatalTestID);
-                                    testsThisWeek.push_back(scheduledTestState);
-                                }
-                                else {
-                                    //std::cout << "test " << i << " not offered or accepted." << endl;
-                                }
-                            }
-                            else {
-                                //std::cout << "test " << i << " within minimum test interval" << endl;
-                            }
-                        }
-                        
-                    }
-                    else {
-                        //std::cout << "test " << i << " already in testThisWeek vector." << endl;
+            if (candidateTests & (1 << i)) {
+                // If weeks since test was last performed is greater than the test's minimum test interval, continue. Otherwise, don't.
+                if ((weekNum - patient->getGeneralState()->weekTestLastPerformed[i]) >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i].minimumTestInterval) {
+                    // Roll for whether test is given based on probability the test is offered and probability the test is performed.
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_OFFER);
+                    if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i].probOfferedAndAccept) {
+                        SimContext::PrenatalTestInstance scheduledTestState = initializePrenatalTestInstance(simContext->getPrenatalTestingInputs()->PrenatalTestsVector[i], patient->getGeneralState()->prenatalTestID);
+                        testsThisWeek.push_back(scheduledTestState);
+                        testsThisWeekMask |= (1 << scheduledTestState.testAssay);
                     }
                 }
-                else {
-                    //std::cout << "test " << i << " not in test available time range." << endl;"
-                }
-            }
-            else {
-                //std::cout << "test " << i << " already in pending follow-up or confirmatory test vectors." << endl;
             }
-            
         }
-        
     }
-    else {
-    }
-    
-    
 
     /* Getting special case tests from special case triggering */
-    for (i = 0; i < patient->getGeneralState()->specialCaseTests[weekNum].size(); i++) {
-        SimContext::PrenatalTestInstance specialCaseTest = patient->getGeneralState()->specialCaseTests[weekNum][i];
+    const PrenatalTestSchedule &specialCaseTests = patient->getGeneralState()->specialCaseTests;
+    for (int entry = specialCaseTests.firstEntry(weekNum); entry != PrenatalTestSchedule::NO_ENTRY; entry = specialCaseTests.nextEntry(entry)) {
+        const SimContext::PrenatalTestInstance &specialCaseTest = specialCaseTests.getTest(entry);
         // checking for special case tests scheduled to be performed this week
         if (specialCaseTest.weekToTest == patient->getGeneralState()->weekNum) {
-            if (patient->getGeneralState()->weekNum >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[specialCaseTest.testAssay].availableStartingWeek &&
-            patient->getGeneralState()->weekNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[specialCaseTest.testAssay].notAvailableAfter) {
+            if (availableTests & (1 << specialCaseTest.testAssay)) {
                 // Checking if test type is already in the pending Follow-Up test vectors. Only add the test to testsThisWeek if it's NOT already in the scheduled follow-up vector. 
-                if (!containsTestType(testsThisWeek, specialCaseTest) ){
+                if (!(testsThisWeekMask & (1 << specialCaseTest.testAssay))) {
                     // If weeks since test was last performed is greater than the test's minimum test interval, continue. Otherwise, don't.
                     if ((patient->getGeneralState()->weekNum - patient->getGeneralState()->weekTestLastPerformed[specialCaseTest.testAssay]) >= simContext->getPrenatalTestingInputs()->PrenatalTestsVector[specialCaseTest.testAssay].minimumTestInterval) {
                         // Roll for whether test is given based on probability the test is offered and probability the test is performed. If yes, add to testsThisWeek vector.
-                        randNum = CmvUtil::getRandomDouble();
+                        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_OFFER);
                         if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[specialCaseTest.testAssay].probOfferedAndAccept) {
                             testsThisWeek.push_back(specialCaseTest);
+                            testsThisWeekMask |= (1 << specialCaseTest.testAssay);
                         }
                     }
                 }
@@ -287,13 +276,11 @@ vector<SimContext::PrenatalTestInstance> PrenatalTestUpdater::getTestsThisWeek()
         }
     }
     
-    /** returning the vector containing the test states for the tests this week  */
-    return testsThisWeek;
 }
 
 
 /** Returns true if a vector containing test states contains the same test type as an individual test state. Basically, ifVectorContains(vector, value)*/
-bool PrenatalTestUpdater::containsTestType(vector< SimContext::PrenatalTestInstance> vect, int prenatalTestNum) {
+bool PrenatalTestUpdater::containsTestType(const vector< SimContext::PrenatalTestInstance> &vect, int prenatalTestNum) {
 	    bool contains = false;
         for (int i = 0; i < vect.size(); i++) {
             if (vect[i].testAssay == prenatalTestNum) {
@@ -302,7 +289,7 @@ bool PrenatalTestUpdater::containsTestType(vector< SimContext::PrenatalTestInsta
         }
 	    return contains;
 }
-bool PrenatalTestUpdater::containsTestType(vector< SimContext::PrenatalTestInstance> vect, SimContext::PrenatalTestInstance prenatalTestInstance) {
+bool PrenatalTestUpdater::containsTestType(const vector< SimContext::PrenatalTestInstance> &vect, const SimContext::PrenatalTestInstance &prenatalTestInstance) {
 	    bool contains = false;
         for (int i = 0; i < vect.size(); i++) {
             if (vect[i].testAssay == prenatalTestInstance.testAssay) {
@@ -361,7 +348,7 @@ void PrenatalTestUpdater::antibodyTestsOutcomesUpdater() {
     }
 }
 
-void PrenatalTestUpdater::postAvidityTestOutcomesUpdater(SimContext::PrenatalTestInstance avidityTestInstance) {
+void PrenatalTestUpdater::postAvidityTestOutcomesUpdater(const SimContext::PrenatalTestInstance &avidityTestInstance) {
     // Checking what the combination of results show:
     if (patient->getMaternalMonitoringState()->IgMStatus == true) {
         if (patient->getMaternalMonitoringState()->IgGStatus == true) {
@@ -413,7 +400,7 @@ void PrenatalTestUpdater::postAvidityTestOutcomesUpdater(SimContext::PrenatalTes
     }
 }
 
-void PrenatalTestUpdater::postMaternalPCROutcomesUpdater(SimContext::PrenatalTestInstance maternalPCRInstance) {
+void PrenatalTestUpdater::postMaternalPCROutcomesUpdater(const SimContext::PrenatalTestInstance &maternalPCRInstance) {
     if (maternalPCRInstance.testAssay != SimContext::MATERNAL_PCR) {
         cout << "ERROR: postMaternalPCROutcomesUpdater is taking in a test that's not Maternal PCR as an argument. " <<endl;cin.get();
     }
@@ -438,7 +425,7 @@ void PrenatalTestUpdater::postMaternalPCROutcomesUpdater(SimContext::PrenatalTes
     }
 }
 
-void PrenatalTestUpdater::postAmniocentesisTest(SimContext::PrenatalTestInstance amniocentesisInstance) {
+void PrenatalTestUpdater::postAmniocentesisTest(const SimContext::PrenatalTestInstance &amniocentesisInstance) {
     if (amniocentesisInstance.testAssay != SimContext::AMNIOCENTESIS) {
         cout << "ERROR: postAmniocentesisTest is taking in a test that's not Amniocentesis as an argument. " <<endl;cin.get();
     }
@@ -488,11 +475,9 @@ void PrenatalTestUpdater::postAmniocentesisTest(SimContext::PrenatalTestInstance
 }
 
 /* DEFINING TESTING EVENTS SEQUENCES */
-SimContext::PrenatalTestInstance PrenatalTestUpdater::performTest(SimContext::PrenatalTestInstance prenatalTestInstance) {
+void PrenatalTestUpdater::performTest(SimContext::PrenatalTestInstance &prenatalTestInstance) {
     // perform ultrasound test 
 
-    SimContext::PrenatalTestInstance prenatalTestInstanceReturn = prenatalTestInstance;
-    
     bool positiveOrNegative = false;
     bool maternalPCRPositiveOrNegative = false;
     int testResult = 0;
@@ -563,20 +548,18 @@ SimContext::PrenatalTestInstance PrenatalTestUpdater::performTest(SimContext::Pr
     //tracer->printTrace(1, "\t%s %s performed. ", SimContext::PRENATAL_TEST_NAMES[prenatalTestInstance.testAssay], SimContext::PRENATAL_TEST_TYPE_NAMES[prenatalTestInstance.testType]);
     // if it's rolled that result will return to patient, add the result to the result return array
     
-    prenatalTestInstanceReturn.result = testResult;
-    prenatalTestInstanceReturn.testPerformed = true;
+    prenatalTestInstance.result = testResult;
+    prenatalTestInstance.testPerformed = true;
     // set that test was performed
-    if (prenatalTestInstanceReturn.testType == SimContext::PN_TEST_FOLLOWUP) {
-        setPendingFollowUpTestPerformed(true, prenatalTestInstanceReturn);
+    if (prenatalTestInstance.testType == SimContext::PN_TEST_FOLLOWUP) {
+        setPendingFollowUpTestPerformed(true, prenatalTestInstance);
     }
-    else if (prenatalTestInstanceReturn.testType == SimContext::PN_TEST_CONF) {
-        setPendingConfirmatoryTestPerformed(true, prenatalTestInstanceReturn);
+    else if (prenatalTestInstance.testType == SimContext::PN_TEST_CONF) {
+        setPendingConfirmatoryTestPerformed(true, prenatalTestInstance);
     }
-    if (prenatalTestInstanceReturn.returnToPatient) {
-        setPrenatalTestResultReturn(prenatalTestInstanceReturn.weekToReturn, prenatalTestInstanceReturn);
+    if (prenatalTestInstance.returnToPatient) {
+        setPrenatalTestResultReturn(prenatalTestInstance.weekToReturn, prenatalTestInstance);
     }
-    
-    return prenatalTestInstanceReturn;
 }
 
 /* Defining events that occur during Routine Ultrasound Test */
@@ -591,7 +574,7 @@ int PrenatalTestUpdater::performRoutineUltrasound() {
     setWeekTestLastPerformed(patient->getGeneralState()->weekNum, SimContext::ROUTINE_US);
     // If child is positive for CMV, roll for abnormal ultrasound result based on odds for SENSITIVITY (stratified by phenotype)
     if (patient->getChildDiseaseState()->hadCMV && patient->getChildDiseaseState()->detectableCMV) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::ROUTINE_US);
         testResult = false; 
         if (randNum < simContext->getPrenatalTestingInputs()->routineUltrasound.testSensitivity[patient->getGeneralState()->trimester][patient->getChildDiseaseState()->phenotypeCMV]){
             testResult = true;
@@ -615,7 +598,7 @@ int PrenatalTestUpdater::performRoutineUltrasound() {
     }
     // If child is NOT positive for CMV, roll for abnormal ultrasound result base don odds for SPECIFICITY (stratified by phenotype)
     else {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::ROUTINE_US);
         testResult = false;
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->routineUltrasound.testSpecificity[patient->getGeneralState()->trimester])){
             testResult = true;
@@ -653,7 +636,7 @@ int PrenatalTestUpdater::performDetailedUltrasound() {
     
     // If child is positive for CMV, roll for abnormal ultrasound result based on odds for SENSITIVITY (stratified by phenotype)
     if (patient->getChildDiseaseState()->hadCMV && patient->getChildDiseaseState()->detectableCMV) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::DETAILED_US);
         testResult = false;
         if (randNum < simContext->getPrenatalTestingInputs()->detailedUltrasound.testSensitivity[patient->getGeneralState()->trimester][patient->getChildDiseaseState()->phenotypeCMV]){
             testResult = true;
@@ -677,7 +660,7 @@ int PrenatalTestUpdater::performDetailedUltrasound() {
     }
     // If child is NOT positive for CMV, roll for abnormal ultrasound result based on odds for SPECIFICITY (stratified by phenotype)
     else {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::DETAILED_US);
         testResult = false;
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->detailedUltrasound.testSpecificity[patient->getGeneralState()->trimester])) {
             testResult = true;
@@ -713,7 +696,7 @@ int PrenatalTestUpdater::performMaternalPCR() {
     setWeekTestLastPerformed(patient->getGeneralState()->weekNum, SimContext::MATERNAL_PCR);
     // If patient's disease state would have positive PCR indicators, roll for PCR positivity based on odds for SENSITIVITY
     if (patient->getMaternalDiseaseState()->PCRWouldBePositive) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::MATERNAL_PCR);
         testResult = false;
         if (randNum < simContext->getPrenatalTestingInputs()->maternalPCR.testSensitivity[patient->getGeneralState()->trimester][0]) {
             testResult = true;
@@ -740,7 +723,7 @@ int PrenatalTestUpdater::performMaternalPCR() {
     }
     // If patient's disease state would have negative PCR indicators, roll for PCR positivity based on odds for SPECIFICITY
     else {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::MATERNAL_PCR);
         testResult = false;
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->maternalPCR.testSpecificity[patient->getGeneralState()->trimester])) {
             testResult = true;
@@ -781,7 +764,7 @@ int PrenatalTestUpdater::performIgM() {
     
     // If mother's TRUE IgM state is positive, roll for Positive Test result based on odds for SENSITIVITY
     if (patient->getMaternalDiseaseState()->IgM) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::IGM);
         testResult = false;
         if (randNum < (simContext->getPrenatalTestingInputs()->igmTest.testSensitivity[patient->getGeneralState()->trimester][0])) {
             testResult = true;
@@ -808,7 +791,7 @@ int PrenatalTestUpdater::performIgM() {
     }
     // If mother's TRUE IgM state is negative, roll for positive test result based on odds for SPECIFICITY
     else {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::IGM);
         testResult = false;
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->igmTest.testSpecificity[patient->getGeneralState()->trimester])){
             testResult = true;
@@ -846,7 +829,7 @@ int PrenatalTestUpdater::performIgG() {
     setWeekTestLastPerformed(patient->getGeneralState()->weekNum, SimContext::IGG);
     // If mother's TRUE IgG state is positive, roll for Positive Test result based on odds for SENSITIVITY
     if (patient->getMaternalDiseaseState()->IgG) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::IGG);
         testResult = false;
         if (randNum < (simContext->getPrenatalTestingInputs()->iggTest.testSensitivity[patient->getGeneralState()->trimester][0])) {
             testResult = true;
@@ -873,7 +856,7 @@ int PrenatalTestUpdater::performIgG() {
     }
     // If mother's TRUE IgG state is negative, roll for positive test result based on odds for SPECIFICITY
     else {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::IGG);
         testResult = false;
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->iggTest.testSpecificity[patient->getGeneralState()->trimester])){
             testResult = true;
@@ -918,7 +901,7 @@ int PrenatalTestUpdater::performIgGAvidity() {
     // Low Avidity case (avidity is actually low according to biological truth)
     if (patient->getMaternalDiseaseState()->avidity == SimContext::LOW_AVIDITY) {
         bool result = false;
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::IGG_AVIDITY);
         if (randNum < (simContext->getPrenatalTestingInputs()->avidityTest.testSensitivity[patient->getGeneralState()->trimester][0])) {
             result = true;
         }
@@ -948,7 +931,7 @@ int PrenatalTestUpdater::performIgGAvidity() {
     // High Avidity case (avidity is actually high according to biological truth)
     else if (patient->getMaternalDiseaseState()->avidity == SimContext::HIGH_AVIDITY) {
         bool result = false;
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::IGG_AVIDITY);
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->avidityTest.testSpecificity[patient->getGeneralState()->trimester])) {
             result = true;
         }
@@ -995,7 +978,7 @@ int PrenatalTestUpdater::performAmniocentesis() {
     setWeekTestLastPerformed(patient->getGeneralState()->weekNum, SimContext::AMNIOCENTESIS);
     // If child's TRUE CMV state is positive, roll for Positive Test result based on odds for SENSITIVITY
     if (patient->getChildDiseaseState()->hadCMV && patient->getChildDiseaseState()->detectableCMV) {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::AMNIOCENTESIS);
         testResult = false;
         if (randNum < (simContext->getPrenatalTestingInputs()->amniocentesis.testSensitivity[patient->getGeneralState()->trimester][patient->getChildDiseaseState()->phenotypeCMV])) {
             testResult = true;
@@ -1021,7 +1004,7 @@ int PrenatalTestUpdater::performAmniocentesis() {
     }
     // If child's TRUE CMV state is negative, roll for positive test result based on odds for SPECIFICITY
     else {
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_RESULT + SimContext::AMNIOCENTESIS);
         testResult = false;
         if (randNum < (1 - simContext->getPrenatalTestingInputs()->amniocentesis.testSpecificity[patient->getGeneralState()->trimester])) {
             testResult = true;
@@ -1046,7 +1029,7 @@ int PrenatalTestUpdater::performAmniocentesis() {
 }
 
 /** endTest function creates the follow-up and confirmatory test objects and adds results to the patient and runStats objects */
-void PrenatalTestUpdater::endTest(SimContext::PrenatalTestInstance prenatalTestInstance) {
+void PrenatalTestUpdater::endTest(const SimContext::PrenatalTestInstance &prenatalTestInstance) {
     double randNum;
     /** Creating the follow-up tests */
     int currTestNumber = prenatalTestInstance.testAssay;
@@ -1077,13 +1060,13 @@ void PrenatalTestUpdater::endTest(SimContext::PrenatalTestInstance prenatalTestI
                     bool testPerformed = false;
                     int weekToReturn = weekToTest + simContext->getPrenatalTestingInputs()->PrenatalTestsVector[fuTestNum].weeksToResultReturn;
                     bool returnToPatient = false;
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
                     if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[fuTestNum].probResultReturn) {
                         returnToPatient = true;
                     }
 
                     // Rolling for whether follow-up tests will occur based on probability of follow-up.
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_FOLLOW_UP);
                     if (randNum < (simContext->getPrenatalTestingInputs()->PrenatalTestsVector[currTestNumber].followUpTestsProbabilities[fuTestNum][prenatalTestInstance.result])){
                         
                         SimContext::PrenatalTestInstance followUpInstance = {patient->getGeneralState()->prenatalTestID, testAssay, testType, confirmatoryNumber, testFollowingUpFrom,
@@ -1129,7 +1112,7 @@ void PrenatalTestUpdater::endTest(SimContext::PrenatalTestInstance prenatalTestI
             bool testPerformed = false;
             int weekToReturn = weekToTest + simContext->getPrenatalTestingInputs()->PrenatalTestsVector[currTestNumber].weeksToResultReturn;
             bool returnToPatient = false;
-            randNum = CmvUtil::getRandomDouble();
+            randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
             if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[currTestNumber].probResultReturn) {
                 returnToPatient = true;
             }
@@ -1160,7 +1143,7 @@ void PrenatalTestUpdater::endTest(SimContext::PrenatalTestInstance prenatalTestI
             bool testPerformed = false;
             int weekToReturn = weekToTest + simContext->getPrenatalTestingInputs()->PrenatalTestsVector[currTestNumber].weeksToResultReturn;
             bool returnToPatient = false;
-            randNum = CmvUtil::getRandomDouble();
+            randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
             if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[currTestNumber].probResultReturn) {
                 returnToPatient = true;
             }
@@ -1204,7 +1187,7 @@ void PrenatalTestUpdater::endTest(SimContext::PrenatalTestInstance prenatalTestI
                     bool testPerformed = false;
                     
                     // rolling for whether follow-up tests will occur based on probability of follow-up.
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_FOLLOW_UP);
                     if (randNum < (simContext->getPrenatalTestingInputs()->PrenatalTestsVector[currTestNumber].FUTriggeredByTestProbabilities[prenatalTestInstance.testFollowingUpFrom][fuTestNum][prenatalTestInstance.result])) {
                         
                         if (currTestNumber == SimContext::IGM) {
@@ -1215,7 +1198,7 @@ void PrenatalTestUpdater::endTest(SimContext::PrenatalTestInstance prenatalTestI
                         }
                         int weekToReturn = weekToTest + simContext->getPrenatalTestingInputs()->PrenatalTestsVector[fuTestNum].weeksToResultReturn;
                         bool returnToPatient = false;
-                        randNum = CmvUtil::getRandomDouble();
+                        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
                         if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[fuTestNum].probResultReturn) {
                             returnToPatient = true;
                         }
@@ -1256,7 +1239,7 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
     bool visitThisWeek = false;
 
     bool attendVisit = false;
-    if (determineIfScheduledVisit()) {
+    if (determineIfScheduledVisit(weekNum)) {
         incrementNumScheduledPrenatalAppointment();
         visitThisWeek = true;
     }
@@ -1277,7 +1260,7 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
             // get probAttendingAppointmentThisWeek from background screening vector
         }
         attendVisit = false;
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_ATTENDANCE);
         if (randNum < probAttendingAppointmentThisWeek) {
             attendVisit = true;
         }
@@ -1285,7 +1268,7 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
     /* If no scheduled appointment, see if there is still a probability of appointment this week due to symptomatic CMV or mild illness */
     else {
         // if scheduled follow up or confirmatory test
-        if (patient->getGeneralState()->pendingFollowUpTests[weekNum].size() > 0 || patient->getGeneralState()->pendingConfirmatoryTests[weekNum].size() > 0) {
+        if (patient->getGeneralState()->pendingFollowUpTests.size(weekNum) > 0 || patient->getGeneralState()->pendingConfirmatoryTests.size(weekNum) > 0) {
             probAttendingAppointmentThisWeek = 1; // if follow up or confirmatory tests have already been scheduled, the appointment will definitely happen.
                                                   // we don't need to roll for follow up test because that happened at the time the test was scheduled
         }
@@ -1298,7 +1281,7 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
             probAttendingAppointmentThisWeek = simContext->getBackgroundScreeningInputs()->seekingHealthcareMildIllness;
         }
         attendVisit = false;
-        randNum = CmvUtil::getRandomDouble();
+        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_ATTENDANCE);
         if (randNum < probAttendingAppointmentThisWeek) {
             attendVisit = true;
         }
@@ -1308,7 +1291,7 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
     if (attendVisit) {
         setAppointmentThisWeek(true);
         // check for pending tests/results 
-        vector<SimContext::PrenatalTestInstance> prenatalTestsToPerform = getTestsThisWeek();
+        getTestsThisWeek(prenatalTestsToPerform);
 
         /* If special case (symptomatic CMV or mild illness) this week, roll for attend appointment and for special case triggered tests */
         // if new CMV infection this week and it's symptomatic, roll for attend appointment and for symptomatic cmv triggered tests
@@ -1323,12 +1306,12 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
                 if (!containsTestType(prenatalTestsToPerform, test)) {
                     double probTest = simContext->getPrenatalTestingInputs()->PrenatalTestsVector[test].symptomaticCMVTrigger;
                     // roll for if test is set to occur. If yes, add it to prenatalTestsToPerform vector
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_TRIGGER);
                     if (randNum < probTest) {
                         int testType = SimContext::PN_TEST_SPECIAL;
                         int weekToReturn = patient->getGeneralState()->weekNum + simContext->getPrenatalTestingInputs()->PrenatalTestsVector[test].weeksToResultReturn;
                         bool returnToPatient = false;
-                        randNum = CmvUtil::getRandomDouble();
+                        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
                         if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[test].probResultReturn) {
                             returnToPatient = true;
                         }
@@ -1353,12 +1336,12 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
                 if (!containsTestType(prenatalTestsToPerform, test)) {
                     double probTest = simContext->getPrenatalTestingInputs()->PrenatalTestsVector[test].mildIllnessTrigger;
                     // roll for if test is set to occur. If yes, add it to prenatalTestsToPerform vector
-                    randNum = CmvUtil::getRandomDouble();
+                    randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TEST_TRIGGER);
                     if (randNum < probTest) {
                         int testType = SimContext::PN_TEST_SPECIAL;
                         int weekToReturn = patient->getGeneralState()->weekNum + simContext->getPrenatalTestingInputs()->PrenatalTestsVector[test].weeksToResultReturn;
                         bool returnToPatient = false;
-                        randNum = CmvUtil::getRandomDouble();
+                        randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_RESULT_RETURN);
                         if (randNum < simContext->getPrenatalTestingInputs()->PrenatalTestsVector[test].probResultReturn) {
                             returnToPatient = true;
                         }
@@ -1380,9 +1363,10 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
             // looping through testsThisWeek vector to perform all prenatal tests this week that haven't yet been performed.
             for (int test = 0; test < prenatalTestsToPerform.size(); test++) {
                 if (!prenatalTestsToPerform[test].testPerformed) { // if the test has not been performed yet
-                    SimContext::PrenatalTestInstance testState = prenatalTestsToPerform[test]; // potential for improper pointer. check this.
-                    testState = performTest(testState);
-                    prenatalTestsToPerform[test].testPerformed = true; // mark test performed as true
+                    // the test is performed in place; performTest and endTest only add tests to the patient's schedules and
+                    // additionalTestsThisWeek, never to prenatalTestsToPerform, so the reference stays valid
+                    SimContext::PrenatalTestInstance &testState = prenatalTestsToPerform[test];
+                    performTest(testState); // marks test performed as true
                     endTest(testState);
                 }
             }
@@ -1396,10 +1380,15 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
     }
 
     // Look at all tests to return this week
-    vector<SimContext::PrenatalTestInstance> prenatalTestsReturnThisWeek = patient->getGeneralState()->prenatalTestResultReturn[patient->getGeneralState()->weekNum];
-    for (int test = 0; test < prenatalTestsReturnThisWeek.size(); test++) {
-        bool result = prenatalTestsReturnThisWeek[test].result;
-        int testAssay = prenatalTestsReturnThisWeek[test].testAssay;
+    // Only the results already scheduled for this week when the loop starts are handled; handling a result never schedules
+    // another result return, so the entries are read in place
+    const PrenatalTestSchedule &prenatalTestResultReturn = patient->getGeneralState()->prenatalTestResultReturn;
+    int numReturnsThisWeek = prenatalTestResultReturn.size(patient->getGeneralState()->weekNum);
+    int returnEntry = prenatalTestResultReturn.firstEntry(patient->getGeneralState()->weekNum);
+    for (int test = 0; test < numReturnsThisWeek; test++, returnEntry = prenatalTestResultReturn.nextEntry(returnEntry)) {
+        const SimContext::PrenatalTestInstance &returnedTest = prenatalTestResultReturn.getTest(returnEntry);
+        bool result = returnedTest.result;
+        int testAssay = returnedTest.testAssay;
         if (result > 1 ) {
             std::cout << "ERROR 001: INVALID RESULT. RESULT INDEX OUT OF RANGE." << endl; cin.get();
         }
@@ -1411,7 +1400,7 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
              * If avidity test result return is abnormal, whether it's returned as low or high avidity depends on whether the patient actually
              * has low or high IgG avidity.
             */
-            if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::IGG_AVIDITY) {
+            if (returnedTest.testAssay == SimContext::IGG_AVIDITY) {
                 int avidityResult = (int)result;
                 if (result == true) {
                     if (patient->getMaternalDiseaseState()->avidity == SimContext::HIGH_AVIDITY) {
@@ -1427,10 +1416,10 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
                 if (patient->getGeneralState()->tracingEnabled) {
                     tracer->printTrace(1, "\t[TEST RESULT RETURN] %s Test Result: %s\n", SimContext::PRENATAL_TEST_NAMES[testAssay], SimContext::TEST_OUTCOME[result]);
                 }
-                if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::IGM) {
+                if (returnedTest.testAssay == SimContext::IGM) {
                     setKnownMaternalIgM(result);
                 }
-                if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::IGG) {
+                if (returnedTest.testAssay == SimContext::IGG) {
                     setKnownMaternalIgG(result);
                 }
 
@@ -1438,32 +1427,32 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
 
             /* Outcome Updater - checking for diagnostic combinations that result in CMV diagnosis */
             
-            if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::IGG) {
+            if (returnedTest.testAssay == SimContext::IGG) {
                 antibodyTestsOutcomesUpdater();
             }
-            else if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::IGG_AVIDITY) {
-                postAvidityTestOutcomesUpdater(prenatalTestsReturnThisWeek[test]);
+            else if (returnedTest.testAssay == SimContext::IGG_AVIDITY) {
+                postAvidityTestOutcomesUpdater(returnedTest);
             }
-            else if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::MATERNAL_PCR) {
-                postMaternalPCROutcomesUpdater(prenatalTestsReturnThisWeek[test]);
+            else if (returnedTest.testAssay == SimContext::MATERNAL_PCR) {
+                postMaternalPCROutcomesUpdater(returnedTest);
             }
             
             if (!patient->getChildMonitoringState()->knownCMV) { // if CMV has not yet been diagnosed in the child, perform child outcomes updater
-                if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::AMNIOCENTESIS) {
-                    postAmniocentesisTest(prenatalTestsReturnThisWeek[test]);
+                if (returnedTest.testAssay == SimContext::AMNIOCENTESIS) {
+                    postAmniocentesisTest(returnedTest);
                 }
                 
             }
             // If CMV has been diagnosed in the child, see if we can determine if the infection is asymptomatic or symptomatic when RUS or DUS test occurs.
             if (patient->getChildMonitoringState()->knownCMV) {
                 if (!patient->getChildMonitoringState()->observedSymptomatic) {
-                    if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::ROUTINE_US) {
-                        if (prenatalTestsReturnThisWeek[test].result == SimContext::ABNORMAL) {
+                    if (returnedTest.testAssay == SimContext::ROUTINE_US) {
+                        if (returnedTest.result == SimContext::ABNORMAL) {
                             // if no DUS currently scheduled, log as symptomatic
                             bool scheduledDetailedUltrasound = false;
                             for (int i = patient->getGeneralState()->weekNum; i < SimContext::MAX_WEEKS_PREGNANT; i++) {
-                                if (containsTestType(patient->getGeneralState()->pendingFollowUpTests[i], SimContext::DETAILED_US) || 
-                                containsTestType(patient->getGeneralState()->pendingConfirmatoryTests[i], SimContext::DETAILED_US)) {
+                                if (patient->getGeneralState()->pendingFollowUpTests.containsTestAssay(i, SimContext::DETAILED_US) || 
+                                patient->getGeneralState()->pendingConfirmatoryTests.containsTestAssay(i, SimContext::DETAILED_US)) {
                                     scheduledDetailedUltrasound = true;
                                 }
                             }
@@ -1473,8 +1462,8 @@ void PrenatalTestUpdater::performWeeklyUpdates() {
                             }
                         }
                     }
-                    else if (prenatalTestsReturnThisWeek[test].testAssay == SimContext::DETAILED_US) {
-                        if (prenatalTestsReturnThisWeek[test].result == SimContext::ABNORMAL) {
+                    else if (returnedTest.testAssay == SimContext::DETAILED_US) {
+                        if (returnedTest.result == SimContext::ABNORMAL) {
                             setChildObservedSymptomaticCMV(true);
                             if (patient->getGeneralState()->tracingEnabled == true) {
                                 tracer->printTrace(1, "Fetal CMV suspected to be symptomatic from Detailed Ultrasound");
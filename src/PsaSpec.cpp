@@ -0,0 +1,295 @@
+#include "include.h"
+
+const char *PsaSpec::DIST_TYPE_NAMES[] = {
+	"beta", "gamma", "lognormal", "uniform"
+};
+
+/** \brief Constructor takes in the name of the .psa file
+ * \param psaFileName the name of the PSA file in the inputs directory; the PSA name is this without its extension
+*/
+PsaSpec::PsaSpec(string psaFileName) {
+    this->psaFileName = psaFileName;
+    psaName = psaFileName.substr(0, psaFileName.find(CmvUtil::FILE_EXTENSION_FOR_PSA));
+    numDraws = 0;
+    psaSeed = 8675309;
+    drawsFile = NULL;
+} /* end Constructor */
+
+/** \brief Destructor closes the draws file if it is still open */
+PsaSpec::~PsaSpec(void) {
+    closeDrawsFile();
+} /* end Destructor */
+
+/** \brief readSpec reads the base input file name, number of draws, seed, and sampled parameters from the PSA file,
+ * throws exception if the file cannot be opened, has an unknown entry or distribution, or has invalid distribution parameters
+*/
+void PsaSpec::readSpec() {
+    CmvUtil::changeDirectoryToInputs();
+    ifstream psaFile(psaFileName.c_str());
+    if (!psaFile.is_open()) {
+        string errorString = "	ERROR - Could not open PSA file ";
+        errorString.append(psaFileName);
+        throw errorString;
+    }
+
+    string line;
+    while (getline(psaFile, line)) {
+        line = line.substr(0, line.find('#'));
+        istringstream lineStream(line);
+        string entry;
+        if (!(lineStream >> entry)) {
+            continue;
+        }
+        if (entry == "BaseInput") {
+            lineStream >> baseInputName;
+        }
+        else if (entry == "NumDraws") {
+            lineStream >> numDraws;
+        }
+        else if (entry == "Seed") {
+            lineStream >> psaSeed;
+        }
+        else if (entry == "Parameter") {
+            PsaParameter parameter;
+            string distName;
+            lineStream >> parameter.parameterPath >> distName;
+            int distType;
+            for (distType = 0; distType < NUM_DIST_TYPES; distType++) {
+                if (distName == DIST_TYPE_NAMES[distType])
+                    break;
+            }
+            if (distType == NUM_DIST_TYPES) {
+                string errorString = "	ERROR - Unknown distribution in PSA file, expected beta, gamma, lognormal, or uniform: ";
+                errorString.append(line);
+                throw errorString;
+            }
+            parameter.distType = (DIST_TYPE) distType;
+            if (!(lineStream >> parameter.distParams[0] >> parameter.distParams[1])) {
+                string errorString = "	ERROR - PSA distribution needs two numeric parameters: ";
+                errorString.append(line);
+                throw errorString;
+            }
+            bool isValid = true;
+            switch (parameter.distType) {
+                case DIST_BETA:
+                case DIST_GAMMA:
+                    isValid = (parameter.distParams[0] > 0 && parameter.distParams[1] > 0);
+                    break;
+                case DIST_LOGNORMAL:
+                    isValid = (parameter.distParams[1] >= 0);
+                    break;
+                case DIST_UNIFORM:
+                    isValid = (parameter.distParams[0] <= parameter.distParams[1]);
+                    break;
+            }
+            if (!isValid) {
+                string errorString = "	ERROR - Invalid distribution parameters in PSA file: ";
+                errorString.append(line);
+                throw errorString;
+            }
+            parameters.push_back(parameter);
+        }
+        else {
+            string errorString = "	ERROR - Unknown entry in PSA file ";
+            errorString.append(psaFileName + ": " + entry);
+            throw errorString;
+        }
+    }
+    if (baseInputName.empty() || parameters.empty() || numDraws <= 0) {
+        string errorString = "	ERROR - PSA file needs a BaseInput, a positive NumDraws, and at least one Parameter: ";
+        errorString.append(psaFileName);
+        throw errorString;
+    }
+} /* end readSpec */
+
+/** \brief validateSpec sets every parameter on a scratch copy of the base inputs, so that a bad path or index is
+ * reported before any draw is run; throws exception on the first error. Oversampled maternal infection is rejected,
+ * since the draws file reports only the unweighted proportions.
+ * \param baseContext a pointer to the SimContext holding the parsed base inputs, not modified
+*/
+void PsaSpec::validateSpec(SimContext *baseContext) {
+    bool isOversampled = baseContext->getRunSpecsInputs()->infectionBiasFactor != 1;
+    for (int i = 0; i < parameters.size(); i++) {
+        isOversampled = isOversampled || parameters[i].parameterPath == "RunSpecs.infectionBiasFactor";
+    }
+    if (isOversampled) {
+        string errorString = "	ERROR - PSA runs cannot oversample maternal infection, the draws would report biased proportions; set InfectionBiasFactor to 1: ";
+        errorString.append(psaFileName);
+        throw errorString;
+    }
+    SimContext *scratchContext = new SimContext(*baseContext);
+    try {
+        for (int i = 0; i < parameters.size(); i++) {
+            scratchContext->setParameter(parameters[i].parameterPath, parameters[i].distParams[0]);
+        }
+    }
+    catch (string &errorString) {
+        delete scratchContext;
+        throw;
+    }
+    delete scratchContext;
+} /* end validateSpec */
+
+/** \brief getBaseRunName returns the run name of the base input: its file name without the .in extension */
+string PsaSpec::getBaseRunName() {
+    return baseInputName.substr(0, baseInputName.find(CmvUtil::FILE_EXTENSION_FOR_INPUT));
+} /* end getBaseRunName */
+
+/** \brief getNumDraws returns the number of parameter sets to draw */
+int PsaSpec::getNumDraws() {
+    return numDraws;
+} /* end getNumDraws */
+
+/** \brief getDrawRunName returns the run name of a draw: the PSA name followed by the draw number
+ * \param drawNum the number of the draw, from 0 to getNumDraws() - 1
+*/
+string PsaSpec::getDrawRunName(int drawNum) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "_%04d", drawNum + 1);
+    return psaName + buffer;
+} /* end getDrawRunName */
+
+/** \brief drawValues samples one value for each parameter, in file order, from a generator keyed by the PSA seed and the draw number
+ * \param drawNum the number of the draw, from 0 to getNumDraws() - 1
+ * \param values set to the sampled value of each parameter
+*/
+void PsaSpec::drawValues(int drawNum, vector<double> &values) {
+    PhiloxRand drawRng(psaSeed, (uint32_t) drawNum);
+    values.resize(parameters.size());
+    for (int i = 0; i < parameters.size(); i++) {
+        values[i] = sampleDist(drawRng, parameters[i]);
+    }
+} /* end drawValues */
+
+/** \brief applyDraw sets the draw's run name and parameter values on a copy of the base SimContext, throws exception if a parameter cannot be set
+ *
+ * Draws are not traced, so the run writes no trace file
+ *
+ * \param simContext a pointer to the SimContext to modify, a copy of the parsed base inputs
+ * \param drawNum the number of the draw, from 0 to getNumDraws() - 1
+ * \param values the sampled value of each parameter, from drawValues
+*/
+void PsaSpec::applyDraw(SimContext *simContext, int drawNum, const vector<double> &values) {
+    simContext->setRunName(getDrawRunName(drawNum));
+    simContext->setParameter("RunSpecs.numberOfPatientsToTrace", 0);
+    for (int i = 0; i < parameters.size(); i++) {
+        simContext->setParameter(parameters[i].parameterPath, values[i]);
+    }
+    simContext->rebuildDerivedInputs();
+} /* end applyDraw */
+
+/** \brief openDrawsFile creates the draws file in the results directory and writes its header, throws exception if it cannot be written */
+void PsaSpec::openDrawsFile() {
+    CmvUtil::changeDirectoryToResults();
+    string drawsFileName = psaName;
+    drawsFileName.append(CmvUtil::FILE_NAME_SUFFIX_PSA_DRAWS);
+    drawsFile = CmvUtil::openFile(drawsFileName.c_str(), "w");
+    if (drawsFile == NULL) {
+        string errorString = "	ERROR - Could not write PSA draws file ";
+        errorString.append(drawsFileName);
+        throw errorString;
+    }
+    fprintf(drawsFile, "Run Name\tBase Input");
+    for (int i = 0; i < parameters.size(); i++) {
+        fprintf(drawsFile, "\t%s", parameters[i].parameterPath.c_str());
+    }
+    fprintf(drawsFile, "\tNum Cohorts\tMaternal CMV\tMild Illness\tMiscarriage\tAverage Week Birth CMV-\tAverage Week Birth CMV+\tChild CMV\n");
+    fflush(drawsFile);
+} /* end openDrawsFile */
+
+/** \brief writeDrawRow appends the parameter values and summary outcomes of one finished draw to the draws file
+ *
+ * Rows are written in the order draws finish and flushed immediately, so partial results can be read while the PSA runs
+ *
+ * \param drawNum the number of the draw, from 0 to getNumDraws() - 1
+ * \param values the sampled value of each parameter, from drawValues
+ * \param runStats a pointer to the finalized RunStats of the draw, which gives the number of patients simulated
+*/
+void PsaSpec::writeDrawRow(int drawNum, const vector<double> &values, RunStats *runStats) {
+    const RunStats::MaternalCohortSummary *maternalSummary = runStats->getMaternalCohortSummary();
+    const RunStats::ChildCohortSummary *childSummary = runStats->getChildCohortSummary();
+    double numCohorts = runStats->getPopulationSummary()->numCohorts;
+
+    lock_guard<mutex> lock(drawsFileMutex);
+    fprintf(drawsFile, "%s\t%s", getDrawRunName(drawNum).c_str(), baseInputName.c_str());
+    for (int i = 0; i < values.size(); i++) {
+        fprintf(drawsFile, "\t%g", values[i]);
+    }
+    fprintf(drawsFile, "\t%d", runStats->getPopulationSummary()->numCohorts);
+    fprintf(drawsFile, "\t%lf", maternalSummary->numCMVInfections / numCohorts);
+    fprintf(drawsFile, "\t%lf", maternalSummary->numMildIllness / numCohorts);
+    fprintf(drawsFile, "\t%lf", (maternalSummary->numMiscarriageNoCMV + maternalSummary->numMiscarriageWithCMV) / numCohorts);
+    fprintf(drawsFile, "\t%lf", childSummary->averageWeekBirthNoCMV);
+    fprintf(drawsFile, "\t%lf", childSummary->averageWeekBirthCMV);
+    fprintf(drawsFile, "\t%lf\n", childSummary->numCMVInfections / numCohorts);
+    fflush(drawsFile);
+} /* end writeDrawRow */
+
+/** \brief closeDrawsFile closes the draws file if it is open */
+void PsaSpec::closeDrawsFile() {
+    if (drawsFile != NULL) {
+        CmvUtil::closeFile(drawsFile);
+        drawsFile = NULL;
+    }
+} /* end closeDrawsFile */
+
+/** \brief sampleGaussian returns a standard normal value using the polar form of the Box-Muller transformation
+ * \param drawRng the generator for the current draw
+*/
+double PsaSpec::sampleGaussian(PhiloxRand &drawRng) {
+    double x1, x2, w;
+    do {
+        x1 = 2.0 * drawRng() - 1.0;
+        x2 = 2.0 * drawRng() - 1.0;
+        w = x1 * x1 + x2 * x2;
+    } while (w >= 1.0 || w == 0.0);
+    return x2 * sqrt((-2.0 * log(w)) / w);
+} /* end sampleGaussian */
+
+/** \brief sampleGamma returns a gamma distributed value with the given shape and unit scale
+ *
+ * Uses the squeeze-free form of Marsaglia and Tsang's method; shapes below 1 are boosted to shape + 1 and scaled back by U^(1/shape)
+ *
+ * \param drawRng the generator for the current draw
+ * \param shape the shape of the gamma distribution, must be positive
+*/
+double PsaSpec::sampleGamma(PhiloxRand &drawRng, double shape) {
+    if (shape < 1) {
+        double u = 1.0 - drawRng();
+        return sampleGamma(drawRng, shape + 1) * pow(u, 1.0 / shape);
+    }
+    double d = shape - 1.0 / 3.0;
+    double c = 1.0 / sqrt(9.0 * d);
+    while (true) {
+        double x = sampleGaussian(drawRng);
+        double v = 1.0 + c * x;
+        if (v <= 0)
+            continue;
+        v = v * v * v;
+        double u = 1.0 - drawRng();
+        if (log(u) < 0.5 * x * x + d - d * v + d * log(v))
+            return d * v;
+    }
+} /* end sampleGamma */
+
+/** \brief sampleDist returns a value drawn from the parameter's distribution
+ * \param drawRng the generator for the current draw
+ * \param parameter the sampled input and its distribution
+*/
+double PsaSpec::sampleDist(PhiloxRand &drawRng, const PsaParameter &parameter) {
+    const double *distParams = parameter.distParams;
+    switch (parameter.distType) {
+        case DIST_BETA: {
+            double x = sampleGamma(drawRng, distParams[0]);
+            double y = sampleGamma(drawRng, distParams[1]);
+            return x / (x + y);
+        }
+        case DIST_GAMMA:
+            return sampleGamma(drawRng, distParams[0]) * distParams[1];
+        case DIST_LOGNORMAL:
+            return exp(distParams[0] + distParams[1] * sampleGaussian(drawRng));
+        case DIST_UNIFORM:
+        default:
+            return distParams[0] + drawRng() * (distParams[1] - distParams[0]);
+    }
+} /* end sampleDist */
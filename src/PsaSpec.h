@@ -0,0 +1,83 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The PsaSpec class reads a probabilistic sensitivity analysis specification (.psa file) and draws its parameter sets.
+ * A PSA names a base .in file, a number of draws, and a distribution for one or more inputs; main parses the base once
+ * and runs one copy of its SimContext per draw, each with its own cohort, and streams one row of results per draw.
+ *
+ * The values of a draw depend only on the PSA seed and the draw number, so a draw can be reproduced in isolation no
+ * matter which thread runs it or in what order.
+ *
+ * PSA file format, one entry per line, with # starting a comment:
+ *   BaseInput <file name of the base .in file, in the inputs directory>
+ *   NumDraws <number of parameter sets to draw>
+ *   Seed <seed for the parameter draws, optional>
+ *   Parameter <parameter path, see SimContext::setParameter> beta <alpha> <beta>
+ *   Parameter <parameter path> gamma <shape> <scale>
+ *   Parameter <parameter path> lognormal <mean of log> <standard deviation of log>
+ *   Parameter <parameter path> uniform <minimum> <maximum>
+*/
+class PsaSpec
+{
+public:
+    /* Constructor takes in the name of the .psa file */
+    PsaSpec(string psaFileName);
+    ~PsaSpec(void);
+
+    /** Distribution types that can be attached to an input */
+    enum DIST_TYPE {DIST_BETA, DIST_GAMMA, DIST_LOGNORMAL, DIST_UNIFORM};
+    static const int NUM_DIST_TYPES = 4;
+    static const char *DIST_TYPE_NAMES[];
+
+    /* readSpec reads the PSA file, throws exception if there is an error */
+    void readSpec();
+    /* validateSpec checks every parameter path against the base inputs, throws exception if there is an error */
+    void validateSpec(SimContext *baseContext);
+
+    /* Functions for accessing and applying the draws */
+    string getBaseRunName();
+    int getNumDraws();
+    string getDrawRunName(int drawNum);
+    void drawValues(int drawNum, vector<double> &values);
+    void applyDraw(SimContext *simContext, int drawNum, const vector<double> &values);
+
+    /* Functions for streaming one row of results per draw to the draws file; writeDrawRow may be called from any thread */
+    void openDrawsFile();
+    void writeDrawRow(int drawNum, const vector<double> &values, RunStats *runStats);
+    void closeDrawsFile();
+
+private:
+    /** PsaParameter stores one sampled input and its distribution */
+    class PsaParameter {
+    public:
+        /** The path of the input, e.g. PrenatalNatHist.weeklyPrimaryCMV */
+        string parameterPath;
+        /** The distribution the input is drawn from */
+        DIST_TYPE distType;
+        /** The two parameters of the distribution, in the order listed in the file format */
+        double distParams[2];
+    };
+
+    /** The name of the .psa file */
+    string psaFileName;
+    /** The PSA name: the .psa file name without its extension, prefixed to every draw run name */
+    string psaName;
+    /** The file name of the base .in file */
+    string baseInputName;
+    /** The number of parameter sets to draw */
+    int numDraws;
+    /** The seed for the parameter draws, kept separate from the seed used to simulate patients */
+    unsigned int psaSeed;
+    /** The sampled inputs */
+    vector<PsaParameter> parameters;
+    /** The draws file and the lock serializing rows written to it from the worker threads */
+    FILE *drawsFile;
+    mutex drawsFileMutex;
+
+    /* Functions for sampling the supported distributions from a generator keyed by the draw */
+    static double sampleGaussian(PhiloxRand &drawRng);
+    static double sampleGamma(PhiloxRand &drawRng, double shape);
+    static double sampleDist(PhiloxRand &drawRng, const PsaParameter &parameter);
+};
@@ -12,6 +12,26 @@ RunStats::RunStats(string runName, SimContext *simContext) {
 
 } /* end constructor*/
 
+/** Names of the outcomes reported for antithetic pairs, indexed by PAIRED_OUTCOME */
+const char *RunStats::PAIRED_OUTCOME_NAMES[] = {
+    "Maternal CMV Infection", "Fetal CMV Infection", "Live Birth", "Miscarriage/Stillbirth", "Diagnosed Maternal CMV",
+    "Any Treatment"
+};
+
+/** Names of the outcomes reported with importance weights, indexed by WEIGHTED_OUTCOME */
+const char *RunStats::WEIGHTED_OUTCOME_NAMES[] = {
+    "Maternal CMV Infection", "Vertical Transmission", "CMV+ Births", "CMV+ Miscarriages/Stillbirths",
+    "CMV+ Births Type 1", "CMV+ Births Type 2", "CMV+ Births Type 3", "CMV+ Births Type 4", "CMV+ Births Type 5"
+};
+
+/** Names of the outcomes whose precision is tracked, indexed by PRECISION_OUTCOME */
+const char *RunStats::PRECISION_OUTCOME_NAMES[] = {
+    "Maternal CMV Infection", "Congenital CMV Infection", "Prenatal Tests per Pregnancy"
+};
+
+/** Standard normal quantile of the two-sided 95% confidence intervals */
+const double RunStats::PRECISION_Z = 1.959964;
+
 /** \brief Destructor clears vectors and frees the allocated objects */
 RunStats::~RunStats(void) {
     
@@ -26,6 +46,10 @@ void RunStats::initRunStats() {
     initChildCohortSummary(); 
     //initMaternalDeathStats(); // Nothing here yet
     initChildDeathStats();
+    initPairedSummary();
+    initWeightedSummary();
+    initPrecisionSummary();
+    initPrenatalTimeSummaries();
 
     patients.clear();
     for (vector<MaternalTimeSummary *>::iterator s = maternalTimeSummaries.begin(); s != maternalTimeSummaries.end(); s++) {
@@ -61,82 +85,281 @@ void RunStats::writeStatsFile() {
             throw errorString;
         }
     }
+    bool isOversampled = simContext->getRunSpecsInputs()->infectionBiasFactor != 1;
+    if (isOversampled) {
+        writeOversampledBanner();
+        fprintf(statsFile, "\n");
+    }
     writePopulationSummary();
+    if (simContext->getRunSpecsInputs()->antitheticPairs) {
+        writePairedSummary();
+    }
+    if (isOversampled) {
+        writeWeightedSummary();
+    }
+    if (simContext->getRunSpecsInputs()->targetRelativeHalfWidth > 0) {
+        writePrecisionSummary();
+    }
+    if (isOversampled) {
+        fprintf(statsFile, "\n");
+        writeOversampledBanner();
+    }
     writePrenatalTimeSummaries();
 }
 
-void RunStats::initPrenatalTimeSummary(PrenatalTimeSummary *currTime) {
-    // Initialize all the prenatal time summary values
-    currTime->timePeriod = 0;
-    currTime->activeMaternalCMV = 0;
-    currTime->activePrimaryMaternalCMV = 0;
-    currTime->activeSecondaryMaternalCMV = 0;
-    currTime->numVerticalTransmissions = 0;
-    for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
-        currTime->numFetalCMVInfections[i] = 0;
-        currTime->numCMVBirthsByPhenotype[i] = 0;
-        currTime->numCMVFetalDeathsByPhenotype[i] = 0;
-    }
-    currTime->numDiagnosedMaternalCMV = 0;
-    for ( int i = 0; i < SimContext::INFECTION_TYPE_MAX; i++) {
-        currTime->numDiagnosedMaternalCMVType[i] = 0;
-    }
-    currTime->numDiagnosedFetalCMV = 0;
-    currTime->numAliveFetuses = 0;
-    currTime->totalNumLiveBirths = 0;
-    currTime->numLiveBirths = 0;
-    currTime->numFetalDeaths = 0;
-
-    // treatment outputs
-    for (int i = 0; i < SimContext::NUM_TREATMENTS; i++) {
-        currTime->numOnTreatment[i] = 0;
-        currTime->numCMVMothersOnTreatment[i] = 0;
-        currTime->numCMVFetusesOnTreatment[i] = 0;
-    }
-
-
-    currTime->maternalNoCMV = 0;
-    currTime->maternalCMVNoTreatment = 0;
-    for (int i = 0; i < SimContext::NUM_TREATMENT_POLICIES; i++) {
-        currTime->maternalCMVOnTreatment[i] = 0;
-        currTime->maternalNoCMVOnTreatment[i] = 0;
-        currTime->numOnTreatment[i] = 0;
-        currTime->fetalCMVOnTreatment[i] = 0;
-        currTime->fetalNoCMVOnTreatment[i] = 0;
-    }
-    currTime->fetalNoCMV = 0;
-    currTime->numMiscarriagesNoFetalCMV = 0;
-    currTime->numMiscarriagesFetalCMV = 0;
-    currTime->numMiscarriagesFetalCMVNoTreatment = 0;
-    for (int i = 0; i < SimContext::NUM_TREATMENT_POLICIES; i++) {
-        currTime->numMiscarriagesFetalCMVTreatment[i] = 0;
-    }
-    currTime->numSymptomaticTriggeredAppointmentsAttended = 0;
-    currTime->numMildIllnessTriggeredAppointmentsAttended = 0;
-    
-    currTime->maternalCMVNoFetalCMV = 0;
-    currTime->numScheduledPrenatalAppointments = 0;
-    currTime->numAttendedPrenatalAppointments = 0;
-    for (int i = 0; i < SimContext::NUM_PRENATAL_TESTS; i++) {
-        currTime->numTestPerfomed[i] = 0;
-        currTime->numTruePositives[i] = 0;
-        currTime->numTrueNegatives[i] = 0;
-        currTime->numFalsePositives[i] = 0;
-        currTime->numFalseNegatives[i] = 0;
-        for (int j = 0; j < SimContext::NUM_CMV_PHENOTYPES; j++) {
-            currTime->numTruePositivesFetalCMV[i][j] = 0;
-            currTime->numFalseNegativesFetalCMV[i][j] = 0;
-        }
-    }
-    currTime->numNewMaternalCMVInfections = 0;
-    currTime->numNewFetalCMVInfections = 0;
-    currTime->numMaternalMildIllness = 0;
-    currTime->numVerticalTransmissions = 0;
-    currTime->birthsCMVNegative = 0;
-    currTime->birthsCMVPositive = 0;
-    for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
-        currTime->newFetalInfectionsByPhenotype[i] = 0;
+/** \brief addRunStats adds all the counters of another RunStats object (e.g. a per-thread shard) into this one.
+ * Every statistic accumulated during the simulation is a count or a sum, so merging the shards in any fixed order
+ * reproduces the values of a single-threaded run. Must be called before finalizeStats.
+ *
+ * \param shard a pointer to the RunStats object whose counters are added to this one
+*/
+void RunStats::addRunStats(const RunStats *shard) {
+    int i;
+
+    /* Population Summary */
+    popSummary.numCohorts += shard->popSummary.numCohorts;
+    popSummary.totalClinicVisitsPregnancy += shard->popSummary.totalClinicVisitsPregnancy;
+    popSummary.numSymptomaticTriggeredVisits += shard->popSummary.numSymptomaticTriggeredVisits;
+    popSummary.numMildIllnessTriggeredVisits += shard->popSummary.numMildIllnessTriggeredVisits;
+    popSummary.totalNumEverOnAnyTreatment += shard->popSummary.totalNumEverOnAnyTreatment;
+    for (i = 0; i < SimContext::NUM_TREATMENTS; i++) {
+        popSummary.totalNumTreatment[i] += shard->popSummary.totalNumTreatment[i];
+        popSummary.totalWeeksOnEachTreatment[i] += shard->popSummary.totalWeeksOnEachTreatment[i];
+        popSummary.numMothersWithTreatmentBirthedCMVPositveChild[i] += shard->popSummary.numMothersWithTreatmentBirthedCMVPositveChild[i];
+        popSummary.numMothersWithTreatmentBirthedCMVNegativeChild[i] += shard->popSummary.numMothersWithTreatmentBirthedCMVNegativeChild[i];
+    }
+    popSummary.numCMVPositiveChildrenBornWithTreatment += shard->popSummary.numCMVPositiveChildrenBornWithTreatment;
+    popSummary.numCMVPositiveChildrenBornNeverTreatment += shard->popSummary.numCMVPositiveChildrenBornNeverTreatment;
+    for (i = 0; i < SimContext::NUM_PRENATAL_TESTS; i++) {
+        popSummary.totalNumPrenatalTest[i] += shard->popSummary.totalNumPrenatalTest[i];
+        popSummary.totalNumPrenatalTestTruePositives[i] += shard->popSummary.totalNumPrenatalTestTruePositives[i];
+        popSummary.totalNumPrenatalTestTrueNegatives[i] += shard->popSummary.totalNumPrenatalTestTrueNegatives[i];
+        popSummary.totalNumPrenatalTestFalsePositives[i] += shard->popSummary.totalNumPrenatalTestFalsePositives[i];
+        popSummary.totalNumPrenatalTestFalseNegatives[i] += shard->popSummary.totalNumPrenatalTestFalseNegatives[i];
+    }
+    for (i = 0; i < SimContext::NUM_TRIMESTERS; i++) {
+        popSummary.numMaternalPrimaryInfectionInTrimester[i] += shard->popSummary.numMaternalPrimaryInfectionInTrimester[i];
+        popSummary.numMaternalSecondaryInfectionInTrimester[i] += shard->popSummary.numMaternalSecondaryInfectionInTrimester[i];
+        popSummary.numPrimaryVTByTrimester[i] += shard->popSummary.numPrimaryVTByTrimester[i];
+        popSummary.numSecondaryVTByTrimester[i] += shard->popSummary.numSecondaryVTByTrimester[i];
     }
+    for (i = 0; i < 3; i++) {
+        popSummary.totalNumVT[i] += shard->popSummary.totalNumVT[i];
+    }
+
+    /* Maternal Cohort Summary */
+    maternalSummary.numCMVInfections += shard->maternalSummary.numCMVInfections;
+    maternalSummary.numPrimaryInfections += shard->maternalSummary.numPrimaryInfections;
+    maternalSummary.numSecondaryInfections += shard->maternalSummary.numSecondaryInfections;
+    maternalSummary.numPrimaryInfectionsAbleToVT += shard->maternalSummary.numPrimaryInfectionsAbleToVT;
+    maternalSummary.numSecondaryInfectionsAbleToVT += shard->maternalSummary.numSecondaryInfectionsAbleToVT;
+    for (i = 0; i < SimContext::NUM_TRIMESTERS; i++) {
+        maternalSummary.numCMVInfectionsByTrimester[i] += shard->maternalSummary.numCMVInfectionsByTrimester[i];
+    }
+    maternalSummary.numMildIllness += shard->maternalSummary.numMildIllness;
+    maternalSummary.numCMVMildIllness += shard->maternalSummary.numCMVMildIllness;
+    maternalSummary.numCMVNoMildIllness += shard->maternalSummary.numCMVNoMildIllness;
+    maternalSummary.numMiscarriageNoCMV += shard->maternalSummary.numMiscarriageNoCMV;
+    maternalSummary.numMiscarriageWithCMV += shard->maternalSummary.numMiscarriageWithCMV;
+    maternalSummary.numBirthWithCMV += shard->maternalSummary.numBirthWithCMV;
+    maternalSummary.numBirthNoCMV += shard->maternalSummary.numBirthNoCMV;
+    maternalSummary.numDiagnosedCMV += shard->maternalSummary.numDiagnosedCMV;
+    maternalSummary.numTruePositiveDiagnosedCMV += shard->maternalSummary.numTruePositiveDiagnosedCMV;
+    maternalSummary.numFalsePositiveDiagnosedCMV += shard->maternalSummary.numFalsePositiveDiagnosedCMV;
+    for (i = 0; i < SimContext::INFECTION_TYPE_MAX; i++) {
+        maternalSummary.numDiagnosedByInfectionStatus[i] += shard->maternalSummary.numDiagnosedByInfectionStatus[i];
+        maternalSummary.numTruePositiveDiagnosedByInfectionStatus[i] += shard->maternalSummary.numTruePositiveDiagnosedByInfectionStatus[i];
+        maternalSummary.numFalsePositiveDiagnosedByInfectionStatus[i] += shard->maternalSummary.numFalsePositiveDiagnosedByInfectionStatus[i];
+    }
+
+    /* Child Cohort Summary (the averages are computed from the sums in finalizeChildCohortSummary) */
+    childSummary.numCMVInfections += shard->childSummary.numCMVInfections;
+    for (i = 0; i < SimContext::NUM_TRIMESTERS; i++) {
+        childSummary.numCMVInfectionsByTrimester[i] += shard->childSummary.numCMVInfectionsByTrimester[i];
+        childSummary.numCMVInfectionsFromPrimaryByTrimester[i] += shard->childSummary.numCMVInfectionsFromPrimaryByTrimester[i];
+        childSummary.numCMVInfectionsFromSecondaryByTrimester[i] += shard->childSummary.numCMVInfectionsFromSecondaryByTrimester[i];
+    }
+    childSummary.numMildIllness += shard->childSummary.numMildIllness;
+    childSummary.sumWeekBirthNoCMV += shard->childSummary.sumWeekBirthNoCMV;
+    childSummary.sumWeekBirthWithCMV += shard->childSummary.sumWeekBirthWithCMV;
+    childSummary.numMiscarriagesWithCMV += shard->childSummary.numMiscarriagesWithCMV;
+    childSummary.numMiscarriagesNoCMV += shard->childSummary.numMiscarriagesNoCMV;
+    childSummary.numBirthWithCMV += shard->childSummary.numBirthWithCMV;
+    childSummary.numBirthNoCMV += shard->childSummary.numBirthNoCMV;
+    childSummary.numDiagnosedCMV += shard->childSummary.numDiagnosedCMV;
+    for (i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
+        childSummary.numWithCMVByType[i] += shard->childSummary.numWithCMVByType[i];
+        childSummary.numBornWithCMVByType[i] += shard->childSummary.numBornWithCMVByType[i];
+        childSummary.numMiscarriagesWithCMVByType[i] += shard->childSummary.numMiscarriagesWithCMVByType[i];
+    }
+    childSummary.numFetalDeathsAtBirth[0] += shard->childSummary.numFetalDeathsAtBirth[0];
+    childSummary.numFetalDeathsAtBirth[1] += shard->childSummary.numFetalDeathsAtBirth[1];
+
+    /* Child Death Stats */
+    childDeathStats.fetalDeaths += shard->childDeathStats.fetalDeaths;
+    childDeathStats.fetalDeathsCMV += shard->childDeathStats.fetalDeathsCMV;
+    for (i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
+        childDeathStats.fetalDeathsByType[i] += shard->childDeathStats.fetalDeathsByType[i];
+    }
+
+    /* Prenatal Time Summaries; the weeks are contiguous and hold nothing but int counters, so the weeks the shard reached
+    are added as one dense array of ints, in a loop the compiler vectorizes */
+    static_assert(std::is_standard_layout<PrenatalTimeSummary>::value && sizeof(PrenatalTimeSummary) % sizeof(int) == 0,
+        "PrenatalTimeSummary must hold only int counters to be merged as an array of ints");
+    int *counters = reinterpret_cast<int *>(prenatalTimeSummaries);
+    const int *shardCounters = reinterpret_cast<const int *>(shard->prenatalTimeSummaries);
+    int numCounters = shard->numPrenatalTimeSummaries * (int) (sizeof(PrenatalTimeSummary) / sizeof(int));
+    for (i = 0; i < numCounters; i++) {
+        counters[i] += shardCounters[i];
+    }
+    numPrenatalTimeSummaries = max(numPrenatalTimeSummaries, shard->numPrenatalTimeSummaries);
+
+    /* Paired Summary; shards hold whole pairs, so only the completed sums are merged. The outcomes are 0 or 1, so the
+    sums are multiples of 1/4 and exact in double precision whatever the order they are added in */
+    pairedSummary.numPairs += shard->pairedSummary.numPairs;
+    for (i = 0; i < NUM_PAIRED_OUTCOMES; i++) {
+        pairedSummary.sumOutcomes[i] += shard->pairedSummary.sumOutcomes[i];
+        pairedSummary.sumSquaredOutcomes[i] += shard->pairedSummary.sumSquaredOutcomes[i];
+        pairedSummary.sumPairMeans[i] += shard->pairedSummary.sumPairMeans[i];
+        pairedSummary.sumSquaredPairMeans[i] += shard->pairedSummary.sumSquaredPairMeans[i];
+    }
+
+    /* Weighted Summary; the weights are summed in fixed point, so the merged sums do not depend on the shard boundaries */
+    weightedSummary.numPatients += shard->weightedSummary.numPatients;
+    weightedSummary.sumWeights.add(shard->weightedSummary.sumWeights);
+    weightedSummary.sumSquaredWeights.add(shard->weightedSummary.sumSquaredWeights);
+    for (i = 0; i < NUM_WEIGHTED_OUTCOMES; i++) {
+        weightedSummary.sumWeightedOutcomes[i].add(shard->weightedSummary.sumWeightedOutcomes[i]);
+        weightedSummary.sumSquaredWeightedOutcomes[i].add(shard->weightedSummary.sumSquaredWeightedOutcomes[i]);
+        weightedSummary.numOutcomes[i] += shard->weightedSummary.numOutcomes[i];
+    }
+
+    /* Precision Summary */
+    addPrecisionSummary(precisionSummary, shard->precisionSummary);
+} /* end addRunStats */
+
+/** \brief addPairedOutcomes adds a finished patient's outcomes to the antithetic pair sums; the second patient of a pair
+ * must be added right after the first, as simulatePatients does
+ *
+ * \param patientNum the number of the patient
+ * \param outcomes the patient's value of each PAIRED_OUTCOME
+*/
+void RunStats::addPairedOutcomes(int patientNum, const double outcomes[NUM_PAIRED_OUTCOMES]) {
+    if (patientNum % 2 == 0) {
+        pairedSummary.pendingPatientNum = patientNum;
+        for (int i = 0; i < NUM_PAIRED_OUTCOMES; i++) {
+            pairedSummary.pendingOutcomes[i] = outcomes[i];
+        }
+        return;
+    }
+    if (pairedSummary.pendingPatientNum != patientNum - 1) {
+        return;
+    }
+    pairedSummary.numPairs++;
+    for (int i = 0; i < NUM_PAIRED_OUTCOMES; i++) {
+        double first = pairedSummary.pendingOutcomes[i];
+        double pairMean = (first + outcomes[i]) / 2;
+        pairedSummary.sumOutcomes[i] += first + outcomes[i];
+        pairedSummary.sumSquaredOutcomes[i] += first * first + outcomes[i] * outcomes[i];
+        pairedSummary.sumPairMeans[i] += pairMean;
+        pairedSummary.sumSquaredPairMeans[i] += pairMean * pairMean;
+    }
+    pairedSummary.pendingPatientNum = -1;
+} /* end addPairedOutcomes */
+
+/** \brief addWeightedOutcomes adds a finished patient's outcomes to the importance weighted sums
+ *
+ * \param importanceWeight the likelihood ratio of the patient's history, see StateUpdater::rollMaternalInfection
+ * \param outcomes whether the patient had each WEIGHTED_OUTCOME
+*/
+void RunStats::addWeightedOutcomes(double importanceWeight, const bool outcomes[NUM_WEIGHTED_OUTCOMES]) {
+    weightedSummary.numPatients++;
+    weightedSummary.sumWeights.add(importanceWeight);
+    weightedSummary.sumSquaredWeights.add(importanceWeight * importanceWeight);
+    for (int i = 0; i < NUM_WEIGHTED_OUTCOMES; i++) {
+        if (outcomes[i]) {
+            weightedSummary.sumWeightedOutcomes[i].add(importanceWeight);
+            weightedSummary.sumSquaredWeightedOutcomes[i].add(importanceWeight * importanceWeight);
+            weightedSummary.numOutcomes[i]++;
+        }
+    }
+} /* end addWeightedOutcomes */
+
+/** \brief addPrecisionOutcomes adds a finished patient's outcomes, scaled by its importance weight, to the running sums
+ * of the PrecisionSummary
+ *
+ * \param importanceWeight the likelihood ratio of the patient's history, 1 unless infectionBiasFactor is set
+ * \param outcomes the patient's value of each PRECISION_OUTCOME
+*/
+void RunStats::addPrecisionOutcomes(double importanceWeight, const int outcomes[NUM_PRECISION_OUTCOMES]) {
+    precisionSummary.numPatients++;
+    for (int i = 0; i < NUM_PRECISION_OUTCOMES; i++) {
+        double weightedOutcome = importanceWeight * outcomes[i];
+        precisionSummary.sumOutcomes[i].add(weightedOutcome);
+        precisionSummary.sumSquaredOutcomes[i].add(weightedOutcome * weightedOutcome);
+    }
+} /* end addPrecisionOutcomes */
+
+/** \brief addPrecisionSummary adds the running sums of one PrecisionSummary, e.g. that of a per-thread shard, into another
+ *
+ * \param total the PrecisionSummary added to
+ * \param shard the PrecisionSummary whose sums are added
+*/
+void RunStats::addPrecisionSummary(PrecisionSummary &total, const PrecisionSummary &shard) {
+    total.numPatients += shard.numPatients;
+    for (int i = 0; i < NUM_PRECISION_OUTCOMES; i++) {
+        total.sumOutcomes[i].add(shard.sumOutcomes[i]);
+        total.sumSquaredOutcomes[i].add(shard.sumSquaredOutcomes[i]);
+    }
+} /* end addPrecisionSummary */
+
+/** \brief getPrecision computes an outcome's mean, its sample standard deviation and the half-width of the 95% confidence
+ * interval of the mean from the running sums; all three are 0 with fewer than two patients
+ *
+ * \param summary the PrecisionSummary holding the sums
+ * \param outcome the PRECISION_OUTCOME
+ * \param mean set to the mean of the outcome
+ * \param stdDev set to the standard deviation of the outcome
+ * \param halfWidth set to the half-width of the confidence interval of the mean
+*/
+void RunStats::getPrecision(const PrecisionSummary &summary, int outcome, double &mean, double &stdDev, double &halfWidth) {
+    int numPatients = summary.numPatients;
+    mean = 0;
+    stdDev = 0;
+    halfWidth = 0;
+    if (numPatients < 2) {
+        return;
+    }
+    double sum = summary.sumOutcomes[outcome].getValue();
+    mean = sum / numPatients;
+    double variance = (summary.sumSquaredOutcomes[outcome].getValue() - sum * mean) / (numPatients - 1);
+    stdDev = sqrt(max(variance, 0.0));
+    halfWidth = PRECISION_Z * stdDev / sqrt((double) numPatients);
+} /* end getPrecision */
+
+/** \brief isPrecisionReached returns whether the confidence interval of every outcome's mean is within the given fraction
+ * of the mean. An outcome that has not occurred yet has no relative precision, so it keeps the run going.
+ *
+ * \param summary the PrecisionSummary holding the sums
+ * \param targetRelativeHalfWidth the largest half-width allowed, as a fraction of the mean
+*/
+bool RunStats::isPrecisionReached(const PrecisionSummary &summary, double targetRelativeHalfWidth) {
+    for (int i = 0; i < NUM_PRECISION_OUTCOMES; i++) {
+        double mean, stdDev, halfWidth;
+        getPrecision(summary, i, mean, stdDev, halfWidth);
+        if (mean <= 0 || halfWidth > targetRelativeHalfWidth * mean) {
+            return false;
+        }
+    }
+    return true;
+} /* end isPrecisionReached */
+
+/** \brief initPrenatalTimeSummaries zeroes the counters of every week and marks no week as reached */
+void RunStats::initPrenatalTimeSummaries() {
+    for (int i = 0; i < SimContext::MAX_WEEKS_PREGNANT; i++) {
+        prenatalTimeSummaries[i] = PrenatalTimeSummary();
+    }
+    numPrenatalTimeSummaries = 0;
 }
 void RunStats::initMaternalTimeSummary(MaternalTimeSummary *maternalCurrStats) {
     maternalCurrStats->numInfections = 0;
@@ -211,6 +434,7 @@ void RunStats::initPopulationSummary() {
     popSummary.runName = "";
     popSummary.runSetName = "";
     popSummary.runTime = "";
+    popSummary.infectionBiasFactor = 1;
 }
 
 void RunStats::initMaternalCohortSummary() {
@@ -274,6 +498,37 @@ void RunStats::initMaternalDeathStats() {
     // empty for now
 }
 
+void RunStats::initPairedSummary() {
+    pairedSummary.numPairs = 0;
+    pairedSummary.pendingPatientNum = -1;
+    for (int i = 0; i < NUM_PAIRED_OUTCOMES; i++) {
+        pairedSummary.sumOutcomes[i] = 0;
+        pairedSummary.sumSquaredOutcomes[i] = 0;
+        pairedSummary.sumPairMeans[i] = 0;
+        pairedSummary.sumSquaredPairMeans[i] = 0;
+        pairedSummary.pendingOutcomes[i] = 0;
+    }
+}
+
+void RunStats::initWeightedSummary() {
+    weightedSummary.numPatients = 0;
+    weightedSummary.sumWeights.clear();
+    weightedSummary.sumSquaredWeights.clear();
+    for (int i = 0; i < NUM_WEIGHTED_OUTCOMES; i++) {
+        weightedSummary.sumWeightedOutcomes[i].clear();
+        weightedSummary.sumSquaredWeightedOutcomes[i].clear();
+        weightedSummary.numOutcomes[i] = 0;
+    }
+}
+
+void RunStats::initPrecisionSummary() {
+    precisionSummary.numPatients = 0;
+    for (int i = 0; i < NUM_PRECISION_OUTCOMES; i++) {
+        precisionSummary.sumOutcomes[i].clear();
+        precisionSummary.sumSquaredOutcomes[i].clear();
+    }
+}
+
 void RunStats::initChildDeathStats() {
     childDeathStats.fetalDeaths = 0;
     childDeathStats.fetalDeathsCMV = 0;
@@ -289,6 +544,7 @@ void RunStats::finalizePopulationSummary() {
     const SimContext::RunSpecsInputs *runSpecs = simContext->getRunSpecsInputs();
     popSummary.runSetName = runSpecs->runSetName;
     popSummary.runName = runSpecs->runName;
+    popSummary.infectionBiasFactor = runSpecs->infectionBiasFactor;
 
 }
 
@@ -326,6 +582,15 @@ void RunStats::finalizeChildTimeSummary() {
     // empty for now
 }
 
+/** \brief writeOversampledBanner warns, ahead of the standard sections, that their counts are of the oversampled cohort;
+ * only the IMPORTANCE SAMPLING WEIGHTED ESTIMATES section is unbiased when maternal infection is oversampled */
+void RunStats::writeOversampledBanner() {
+    double infectionBiasFactor = simContext->getRunSpecsInputs()->infectionBiasFactor;
+    fprintf(statsFile, "*** OVERSAMPLED, UNWEIGHTED: maternal CMV infection is oversampled (Infection Bias Factor %lf). The counts and"
+        " proportions in the sections below are of the oversampled cohort and are biased; see IMPORTANCE SAMPLING WEIGHTED ESTIMATES"
+        " for unbiased estimates. ***", infectionBiasFactor);
+} /* end writeOversampledBanner */
+
 /** \brief writePopulationSummary outputs the PopulationSummary statistics to the stats file */
 void RunStats::writePopulationSummary() {
 	int i;
@@ -334,7 +599,7 @@ void RunStats::writePopulationSummary() {
 	fprintf(statsFile, "POPULATION SUMMARY MEASURES (run completed %s,", popSummary.runDate.c_str());
     fprintf(statsFile, "%s)\n[Program version %s, build %s]", popSummary.runTime.c_str(),
         CmvUtil::CMV_VERSION_STRING, CmvUtil::CMV_EXECUTABLE_COMPILED_DATE);
-    fprintf(statsFile, "\n\tRun Size\t%d", simContext->getRunSpecsInputs()->numCohorts);
+    fprintf(statsFile, "\n\tRun Size\t%d", popSummary.numCohorts);
     fprintf(statsFile, "\n\tNumber of Maternal CMV Infections\t%d", maternalSummary.numCMVInfections);
     fprintf(statsFile, "\n\tNumber of Fetal CMV Infections\t%d", childSummary.numCMVInfections);
     //fprintf(statsFile, "\n\tProportion of Incident Maternal CMV Infections\t%lf");
@@ -556,13 +821,92 @@ void RunStats::writePopulationSummary() {
     fprintf(statsFile, "\n\tcCMV+ children born to moms who were NEVER on treatment\t%d", popSummary. numCMVPositiveChildrenBornNeverTreatment);
 }
 
+/** \brief writePairedSummary outputs the antithetic paired estimate of each outcome's mean next to the estimate for
+ * independent patients. The standard error of the paired estimator comes from the spread of the pair means; the
+ * independent one is what a cohort of the same size without pairing would give. Their variance ratio is the factor by
+ * which an unpaired cohort would have to grow to match the precision of the paired one.
+*/
+void RunStats::writePairedSummary() {
+    int numPairs = pairedSummary.numPairs;
+    fprintf(statsFile, "\n\nANTITHETIC PAIRED ESTIMATES\n\tNumber of Pairs\t%d", numPairs);
+    fprintf(statsFile, "\n\t\tMean\tStd Error (Paired)\tStd Error (Independent)\tVariance Ratio");
+    for (int i = 0; i < NUM_PAIRED_OUTCOMES; i++) {
+        double mean = 0;
+        double pairedVariance = 0;
+        double independentVariance = 0;
+        if (numPairs > 1) {
+            int numPatients = 2 * numPairs;
+            mean = pairedSummary.sumPairMeans[i] / numPairs;
+            /* Sample variances of the pair means and of the individual outcomes, divided by the number of samples averaged */
+            pairedVariance = (pairedSummary.sumSquaredPairMeans[i] - numPairs * mean * mean) / (numPairs - 1) / numPairs;
+            independentVariance = (pairedSummary.sumSquaredOutcomes[i] - numPatients * mean * mean) / (numPatients - 1) / numPatients;
+        }
+        fprintf(statsFile, "\n\t%s\t%lf\t%lf\t%lf", PAIRED_OUTCOME_NAMES[i], mean, sqrt(max(pairedVariance, 0.0)),
+            sqrt(max(independentVariance, 0.0)));
+        if (pairedVariance > 0) {
+            fprintf(statsFile, "\t%lf", independentVariance / pairedVariance);
+        }
+        else {
+            fprintf(statsFile, "\t-");
+        }
+    }
+} /* end writePairedSummary */
+
+/** \brief writeWeightedSummary outputs the importance sampling estimate of each outcome's proportion with its standard
+ * error, next to the proportion among the simulated (oversampled) patients. The counts in the other sections are of the
+ * simulated patients and are biased towards infection; only the estimates here are unbiased. The effective sample size
+ * (sum of weights squared over sum of squared weights) shows how many unweighted patients the weights are worth.
+*/
+void RunStats::writeWeightedSummary() {
+    int numPatients = weightedSummary.numPatients;
+    double sumWeights = weightedSummary.sumWeights.getValue();
+    double sumSquaredWeights = weightedSummary.sumSquaredWeights.getValue();
+    fprintf(statsFile, "\n\nIMPORTANCE SAMPLING WEIGHTED ESTIMATES");
+    fprintf(statsFile, "\n\tInfection Bias Factor\t%lf", simContext->getRunSpecsInputs()->infectionBiasFactor);
+    fprintf(statsFile, "\n\tNumber of Patients\t%d", numPatients);
+    fprintf(statsFile, "\n\tMean Weight\t%lf", numPatients > 0 ? sumWeights / numPatients : 0.0);
+    fprintf(statsFile, "\n\tEffective Sample Size\t%lf", sumSquaredWeights > 0 ? sumWeights * sumWeights / sumSquaredWeights : 0.0);
+    fprintf(statsFile, "\n\t\tWeighted Proportion\tStd Error\tNumber Simulated\tProportion Simulated");
+    for (int i = 0; i < NUM_WEIGHTED_OUTCOMES; i++) {
+        double proportion = 0;
+        double variance = 0;
+        if (numPatients > 1) {
+            proportion = weightedSummary.sumWeightedOutcomes[i].getValue() / numPatients;
+            variance = (weightedSummary.sumSquaredWeightedOutcomes[i].getValue() - numPatients * proportion * proportion) / (numPatients - 1) / numPatients;
+        }
+        fprintf(statsFile, "\n\t%s\t%lf\t%lf\t%d\t%lf", WEIGHTED_OUTCOME_NAMES[i], proportion, sqrt(max(variance, 0.0)),
+            weightedSummary.numOutcomes[i], numPatients > 0 ? (double)weightedSummary.numOutcomes[i] / numPatients : 0.0);
+    }
+} /* end writeWeightedSummary */
+
+/** \brief writePrecisionSummary writes the precision reached by each tracked outcome's mean, and how many of the cohort's
+ * patients were needed to reach the target; with an infectionBiasFactor the means are the importance-weighted estimates */
+void RunStats::writePrecisionSummary() {
+    const SimContext::RunSpecsInputs *runSpecs = simContext->getRunSpecsInputs();
+    fprintf(statsFile, "\n\nPRECISION OF ESTIMATES\n\tTarget Relative CI Half-Width\t%lf", runSpecs->targetRelativeHalfWidth);
+    fprintf(statsFile, "\n\tPatients Simulated\t%d\n\tCohort Size\t%d", precisionSummary.numPatients, runSpecs->numCohorts);
+    fprintf(statsFile, "\n\tTarget Reached\t%s", isPrecisionReached(precisionSummary, runSpecs->targetRelativeHalfWidth) ? "True" : "False");
+    fprintf(statsFile, "\n\t\tMean\tStd Dev\t95%% CI Half-Width\tRelative CI Half-Width");
+    for (int i = 0; i < NUM_PRECISION_OUTCOMES; i++) {
+        double mean, stdDev, halfWidth;
+        getPrecision(precisionSummary, i, mean, stdDev, halfWidth);
+        fprintf(statsFile, "\n\t%s\t%lf\t%lf\t%lf", PRECISION_OUTCOME_NAMES[i], mean, stdDev, halfWidth);
+        if (mean > 0) {
+            fprintf(statsFile, "\t%lf", halfWidth / mean);
+        }
+        else {
+            fprintf(statsFile, "\tN/A");
+        }
+    }
+} /* end writePrecisionSummary */
+
 void RunStats::writePrenatalTimeSummaries() {
     int j, k;
     const SimContext::RunSpecsInputs *runSpecs = simContext->getRunSpecsInputs();
-    for (vector<PrenatalTimeSummary *>::iterator t = prenatalTimeSummaries.begin(); t != prenatalTimeSummaries.end(); t++) {
-        PrenatalTimeSummary *currTime = *t;
+    for (int week = 0; week < numPrenatalTimeSummaries; week++) {
+        const PrenatalTimeSummary *currTime = &prenatalTimeSummaries[week];
 
-        fprintf(statsFile, "\nCOHORT SUMMARY FOR WEEK %d", currTime->timePeriod);
+        fprintf(statsFile, "\nCOHORT SUMMARY FOR WEEK %d", week);
         fprintf(statsFile, "\n\tNum Alive Fetuses\t%d", currTime->numAliveFetuses);
         fprintf(statsFile, "\n\tNum Vertical Transmissions\t%d", currTime->numVerticalTransmissions);
         //fprintf(statsFile, "\n\t# Diagnosed\tMothers\tChildren");
@@ -2,7 +2,8 @@
 
 #include "include.h"
 
-class RunStats
+/** RunStats is aligned to a 64 byte cache line, so the per-thread shards that worker threads update never share a line */
+class alignas(64) RunStats
 {
 public:
     /** Make the StateUpdater class a friend class so it can modify the private data */
@@ -33,6 +34,8 @@ public:
         string runDate;
         /** The time the run finished */
         string runTime;
+        /** RunSpecs infectionBiasFactor of the run; when not 1 the counts are of the oversampled cohort, unweighted */
+        double infectionBiasFactor;
         // Number of patient and clinic visit aggregates 
         /** The number of mother/child(ren) pairs in this cohort */
         int numCohorts;
@@ -183,11 +186,10 @@ public:
         int fetalDeathsCMV;
     };
 
-    /** TimeSummary class contains weekly/monthly longitudinal stats */
+    /** TimeSummary class contains weekly/monthly longitudinal stats; the week is its index in prenatalTimeSummaries.
+     * Every field is an int counter, which addRunStats relies on to merge the weeks as one dense array of ints. */
     class PrenatalTimeSummary {
     public:
-        /** Time period week */
-        int timePeriod;
         /** Number of Active Maternal CMV Infections */
         int activeMaternalCMV;
         /** Number of Active Primary Maternal CMV Infections */
@@ -330,6 +332,76 @@ public:
         int numVerticalTransmissions;
     };
 
+    /** Per-patient outcomes accumulated by antithetic pair when RunSpecs antitheticPairs is on */
+    enum PAIRED_OUTCOME {PAIRED_MATERNAL_CMV, PAIRED_FETAL_CMV, PAIRED_LIVE_BIRTH, PAIRED_FETAL_DEATH, PAIRED_MATERNAL_DIAGNOSED,
+        PAIRED_ANY_TREATMENT};
+    static const int NUM_PAIRED_OUTCOMES = 6;
+    static const char *PAIRED_OUTCOME_NAMES[];
+
+    /** PairedSummary holds the sums needed to compare the antithetic paired estimator of each outcome's mean with the
+     * estimator for independent patients. Patients 2k and 2k+1 form pair k; a pair is counted once both are added. */
+    class PairedSummary {
+    public:
+        /** Number of complete pairs */
+        int numPairs;
+        /** Sum over the patients of complete pairs of each outcome, and of its square */
+        double sumOutcomes[NUM_PAIRED_OUTCOMES];
+        double sumSquaredOutcomes[NUM_PAIRED_OUTCOMES];
+        /** Sum over complete pairs of the pair's mean outcome, and of its square */
+        double sumPairMeans[NUM_PAIRED_OUTCOMES];
+        double sumSquaredPairMeans[NUM_PAIRED_OUTCOMES];
+        /** The patient number and outcomes of a first patient whose pair is not complete yet, -1 if none */
+        int pendingPatientNum;
+        double pendingOutcomes[NUM_PAIRED_OUTCOMES];
+    };
+
+    /** Per-patient outcomes estimated with importance weights when RunSpecs infectionBiasFactor is set; the last
+     * NUM_CMV_PHENOTYPES are the CMV+ births of each phenotype */
+    enum WEIGHTED_OUTCOME {WEIGHTED_MATERNAL_CMV, WEIGHTED_VERTICAL_TRANSMISSION, WEIGHTED_CMV_BIRTH, WEIGHTED_CMV_FETAL_DEATH,
+        WEIGHTED_CMV_BIRTH_BY_TYPE};
+    static const int NUM_WEIGHTED_OUTCOMES = WEIGHTED_CMV_BIRTH_BY_TYPE + SimContext::NUM_CMV_PHENOTYPES;
+    static const char *WEIGHTED_OUTCOME_NAMES[];
+
+    /** WeightedSummary holds the sums needed for the importance sampling estimate of each outcome's proportion: every
+     * patient adds its importance weight to the outcomes it had, so the weighted proportions estimate those of the
+     * unbiased cohort while the oversampled infections make their standard errors smaller. The weights are summed in
+     * fixed point so that merging the per-thread shards gives the same sums for any number of threads. */
+    class WeightedSummary {
+    public:
+        /** Number of patients added */
+        int numPatients;
+        /** Sum of the patients' importance weights, and of their squares */
+        FixedPointSum sumWeights;
+        FixedPointSum sumSquaredWeights;
+        /** Sum of the importance weights of the patients who had each outcome, and of their squares */
+        FixedPointSum sumWeightedOutcomes[NUM_WEIGHTED_OUTCOMES];
+        FixedPointSum sumSquaredWeightedOutcomes[NUM_WEIGHTED_OUTCOMES];
+        /** Number of simulated patients who had each outcome, without weights */
+        int numOutcomes[NUM_WEIGHTED_OUTCOMES];
+    };
+
+    /** Per-patient outcomes whose confidence intervals are tracked as the cohort runs, to stop it early once RunSpecs
+     * targetRelativeHalfWidth is reached */
+    enum PRECISION_OUTCOME {PRECISION_MATERNAL_CMV, PRECISION_CONGENITAL_CMV, PRECISION_TESTS_PER_PREGNANCY};
+    static const int NUM_PRECISION_OUTCOMES = 3;
+    static const char *PRECISION_OUTCOME_NAMES[];
+    /** Standard normal quantile of the two-sided 95% confidence intervals */
+    static const double PRECISION_Z;
+
+    /** PrecisionSummary holds running sums of each outcome and of its square, from which the mean, the variance and the
+     * confidence interval of the mean follow after any number of patients. Each outcome is scaled by the patient's
+     * importance weight, so with an infectionBiasFactor the precision is that of the weighted estimates rather than of
+     * the oversampled counts. The sums are in fixed point: they merge across the per-thread shards in any order with no
+     * rounding, and the point at which a run stops does not depend on the number of threads. */
+    class PrecisionSummary {
+    public:
+        /** Number of patients added */
+        int numPatients;
+        /** Sum of each weighted outcome over the patients, and of its square */
+        FixedPointSum sumOutcomes[NUM_PRECISION_OUTCOMES];
+        FixedPointSum sumSquaredOutcomes[NUM_PRECISION_OUTCOMES];
+    };
+
     /* ChildTimeSummary class contains maternal weekly/monthly longitudinal stats */
     class ChildTimeSummary {
     public:
@@ -351,6 +423,9 @@ public:
     const ChildCohortSummary *getChildCohortSummary();
     const MaternalDeathStats *getMaternalDeathStats();
     const ChildDeathStats *getChildDeathStats();
+    const PairedSummary *getPairedSummary();
+    const WeightedSummary *getWeightedSummary();
+    const PrecisionSummary *getPrecisionSummary();
     const PrenatalTimeSummary *getPrenatalTimeSummary(unsigned int timePeriod);
     const MaternalTimeSummary *getMaternalTimeSummary(unsigned int timePeriod);
     const ChildTimeSummary *getChildTimeSummary(unsigned int timePeriod);
@@ -359,9 +434,19 @@ public:
     void initRunStats();
     void finalizeStats();
     void writeStatsFile();
+    /* Function to merge a per-thread shard into this object */
+    void addRunStats(const RunStats *shard);
 
     /* Functions to increment or change run statistics */
     void incrementNumCMV();
+    void addPairedOutcomes(int patientNum, const double outcomes[NUM_PAIRED_OUTCOMES]);
+    void addWeightedOutcomes(double importanceWeight, const bool outcomes[NUM_WEIGHTED_OUTCOMES]);
+    void addPrecisionOutcomes(double importanceWeight, const int outcomes[NUM_PRECISION_OUTCOMES]);
+
+    /* Functions on the precision sums, also used to check the shards of a run together before they are merged */
+    static void addPrecisionSummary(PrecisionSummary &total, const PrecisionSummary &shard);
+    static void getPrecision(const PrecisionSummary &summary, int outcome, double &mean, double &stdDev, double &halfWidth);
+    static bool isPrecisionReached(const PrecisionSummary &summary, double targetRelativeHalfWidth);
 
 private:
     /** Pointer to the associated simulation context */
@@ -381,12 +466,22 @@ private:
     MaternalDeathStats maternalDeathStats;
     /** Statistics subclass object */
     ChildDeathStats childDeathStats;
+    /** Statistics subclass object, only written out for antithetic pairs */
+    PairedSummary pairedSummary;
+    /** Statistics subclass object, only written out when infection is oversampled */
+    WeightedSummary weightedSummary;
+    /** Statistics subclass object, only written out when the run stops at a target precision */
+    PrecisionSummary precisionSummary;
     /** vector of PatientSummary objects for all cohorts in this context */
     vector<PatientSummary> patients;
+    /** PrenatalTimeSummary objects for each week of pregnancy, allocated with the RunStats object in one contiguous block,
+     * so that an update is a plain index and the shards merge as a dense array of counters */
+    PrenatalTimeSummary prenatalTimeSummaries[SimContext::MAX_WEEKS_PREGNANT];
+    /** Number of weeks any patient has reached, i.e. of prenatalTimeSummaries written out */
+    int numPrenatalTimeSummaries;
     /** Vectors of MaternalTimeSummary and ChildTimeSummary objects for each week/month time period, 
      * use pointer to object since subclass is complex and copy would be expensive
     */
-   vector<PrenatalTimeSummary * > prenatalTimeSummaries;
    vector<MaternalTimeSummary * > maternalTimeSummaries;
    vector<ChildTimeSummary *> childTimeSummaries;
 
@@ -396,7 +491,10 @@ private:
     void initChildCohortSummary();
     void initMaternalDeathStats();
     void initChildDeathStats();
-    void initPrenatalTimeSummary(PrenatalTimeSummary *currTime);
+    void initPairedSummary();
+    void initWeightedSummary();
+    void initPrecisionSummary();
+    void initPrenatalTimeSummaries();
     void initMaternalTimeSummary(MaternalTimeSummary* maternalCurrStats);
     void initChildTimeSummary(ChildTimeSummary* childCurrStats);
 
@@ -410,7 +508,11 @@ private:
     void finalizeChildTimeSummary();
 
     /* Functions to write out each subclass object to the statistics file, called by writeStatsFile */
+    void writeOversampledBanner();
     void writePopulationSummary();
+    void writePairedSummary();
+    void writeWeightedSummary();
+    void writePrecisionSummary();
     void writeMaternalCohortSummary();
     void writeChildCohortSummary();
     void writeMaternalDeathStats();
@@ -441,7 +543,26 @@ inline const RunStats::MaternalDeathStats *RunStats::getMaternalDeathStats() {
 inline const RunStats::ChildDeathStats *RunStats::getChildDeathStats() {
     return &childDeathStats;
 }
+/** \brief getPairedSummary returns a const pointer to the PairedSummary statistics object */
+inline const RunStats::PairedSummary *RunStats::getPairedSummary() {
+    return &pairedSummary;
+}
+/** \brief getWeightedSummary returns a const pointer to the WeightedSummary statistics object */
+inline const RunStats::WeightedSummary *RunStats::getWeightedSummary() {
+    return &weightedSummary;
+}
+/** \brief getPrecisionSummary returns a const pointer to the PrecisionSummary statistics object */
+inline const RunStats::PrecisionSummary *RunStats::getPrecisionSummary() {
+    return &precisionSummary;
+}
 
+/** \brief getPrenatalTimeSummary returns a const pointer to the PrenatalTimeSummary object of the specified week,
+	returns null if no patient has reached that week */
+inline const RunStats::PrenatalTimeSummary *RunStats::getPrenatalTimeSummary(unsigned int timePeriod) {
+    if (timePeriod < (unsigned int) numPrenatalTimeSummaries)
+        return &prenatalTimeSummaries[timePeriod];
+    return NULL;
+}
 /** \brief getMaternalTimeSummary returns a const pointer to the specified MaternalTimeSummary object,
 	returns null if one does not exist for this time period */
 inline const RunStats::MaternalTimeSummary *RunStats::getMaternalTimeSummary(unsigned int timePeriod) {
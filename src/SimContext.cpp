@@ -1,9 +1,21 @@
 #include "include.h"
 #include <string>
 
-/* Constructor takes run name as parameter */
-SimContext::SimContext(string runName) {
+/* Constructor takes run name as parameter; the input blocks are value-initialized so the entries an input file leaves
+unset are zero rather than whatever the heap last held, and a run gives the same results wherever it is allocated */
+SimContext::SimContext(string runName) :
+	runSpecsInputs(),
+	cohortInputs(),
+	prenatalNatHistInputs(),
+	backgroundScreeningInputs(),
+	prenatalTestingInputs(),
+	prenatalTreatmentInputs(),
+	postpartumInputs(),
+	infantInputs(),
+	adultInputs()
+{
 	counter=0;
+	inputTokens = NULL;
 	inputFileName = runName;
 	inputFileName.append(".in");
 	runSpecsInputs.runName = runName;
@@ -48,14 +60,24 @@ SimContext::PrenatalTestState::~PrenatalTestState(){
 
 void SimContext::readInputs() {
 	CmvUtil::changeDirectoryToInputs();
-	inputFile = CmvUtil::openFile(inputFileName.c_str(), "r");
-	if (inputFile == NULL) {
+
+	/* Load the binary cache stored next to the input file if it was compiled from identical contents */
+	string inputContents;
+	if (!CmvUtil::readFileContents(inputFileName.c_str(), inputContents)) {
 		string errorString = "	ERROR - Could not open input file ";
 		errorString.append(inputFileName);
 		throw errorString;
 	}
+	unsigned long long inputHash = CmvUtil::hashBytes(inputContents.data(), inputContents.size());
+	string cacheFileName = runSpecsInputs.runName;
+	cacheFileName.append(CmvUtil::FILE_EXTENSION_FOR_INPUT_CACHE);
+	if (readInputsCache(cacheFileName, inputHash)) {
+		return;
+	}
 
-	/* Read all the input data from the file*/
+	/* Tokenize the file once and read all the input data from the token index */
+	InputTokenizer tokenizer(inputContents);
+	inputTokens = &tokenizer;
 	readRunSpecsInputs();
 	readCohortInputs();
 	readPrenatalNatHistInputs();
@@ -66,42 +88,74 @@ void SimContext::readInputs() {
 	readInfantInputs();
 	readAdultInputs();
 
-	/* Close the input file */
-	CmvUtil::closeFile(inputFile);
+	inputTokens = NULL;
+
+	buildDistributions();
+	buildTestingMasks();
+	writeInputsCache(cacheFileName, inputHash);
 }
 
 /* readRunSpecsInputs reads data from the RunSpecs tab of the input sheet */
 void SimContext::readRunSpecsInputs() {
-	char buffer[256];
 	// read in name of set this run belongs to 
-	readAndSkipPast("Runset", inputFile);
-	fscanf(inputFile, "%299s", buffer);
-	runSpecsInputs.runSetName = buffer;
+	readAndSkipPast("Runset");
+	readString(runSpecsInputs.runSetName);
 	// read in cohort size
-	readAndSkipPast("CohortSize", inputFile);
-	fscanf(inputFile, "%d", &runSpecsInputs.numCohorts);
+	readAndSkipPast("CohortSize");
+	readInt(runSpecsInputs.numCohorts);
 	// read in annual discount factor
-	readAndSkipPast("AnnualDiscountFactor", inputFile);
-	fscanf(inputFile, "%lf", &runSpecsInputs.annualDiscountFactor);
+	readAndSkipPast("AnnualDiscountFactor");
+	readDouble(runSpecsInputs.annualDiscountFactor);
 	// random initial seed by time
-	readAndSkipPast("RandomInitialSeedByTime", inputFile);
-	fscanf(inputFile, "%d", &runSpecsInputs.randomSeedByTime);
+	readAndSkipPast("RandomInitialSeedByTime");
+	readInt(runSpecsInputs.randomSeedByTime);
 	// last active CMV Strata
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[0], inputFile); // "VERY RECENT" (on input sheet)
-	fscanf(inputFile, "%d", &runSpecsInputs.lastActiveCMVStrataBounds[0]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[1], inputFile); // "MEDIUM RECENT" (on input sheet)
-	fscanf(inputFile, "%d", &runSpecsInputs.lastActiveCMVStrataBounds[1]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[2], inputFile); // "LESS RECENT" (on input sheet)
-	fscanf(inputFile, "%d", &runSpecsInputs.lastActiveCMVStrataBounds[2]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[3], inputFile); // "LONG TIME AGO" (on input sheet)
-	fscanf(inputFile, "%d", &runSpecsInputs.lastActiveCMVStrataBounds[3]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[4], inputFile); // "NEVER CMV" (on input sheet)
-	fscanf(inputFile, "%d", &runSpecsInputs.lastActiveCMVStrataBounds[4]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[0]); // "VERY RECENT" (on input sheet)
+	readInt(runSpecsInputs.lastActiveCMVStrataBounds[0]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[1]); // "MEDIUM RECENT" (on input sheet)
+	readInt(runSpecsInputs.lastActiveCMVStrataBounds[1]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[2]); // "LESS RECENT" (on input sheet)
+	readInt(runSpecsInputs.lastActiveCMVStrataBounds[2]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[3]); // "LONG TIME AGO" (on input sheet)
+	readInt(runSpecsInputs.lastActiveCMVStrataBounds[3]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[4]); // "NEVER CMV" (on input sheet)
+	readInt(runSpecsInputs.lastActiveCMVStrataBounds[4]);
 
 
 	// read number of patients to trace
-	readAndSkipPast("NumPatientsTrace", inputFile);
-	fscanf(inputFile, "%d", &runSpecsInputs.numberOfPatientsToTrace);
+	readAndSkipPast("NumPatientsTrace");
+	readInt(runSpecsInputs.numberOfPatientsToTrace);
+	// read whether to simulate patients in antithetic pairs; optional, off if the label is absent
+	runSpecsInputs.antitheticPairs = false;
+	if (inputTokens->skipPast("AntitheticPairs")) {
+		readInt(runSpecsInputs.antitheticPairs);
+	}
+	// read the importance sampling bias of maternal infection; optional, off (1) if the label is absent
+	runSpecsInputs.infectionBiasFactor = 1;
+	if (inputTokens->skipPast("InfectionBiasFactor")) {
+		readDouble(runSpecsInputs.infectionBiasFactor);
+		if (runSpecsInputs.infectionBiasFactor <= 0) {
+			string errorString = "	ERROR - InfectionBiasFactor must be positive";
+			throw errorString;
+		}
+	}
+	// read the precision at which the cohort stops early and how often it is checked; optional, off (0) if the label is absent
+	runSpecsInputs.targetRelativeHalfWidth = 0;
+	if (inputTokens->skipPast("TargetRelativeCIHalfWidth")) {
+		readDouble(runSpecsInputs.targetRelativeHalfWidth);
+		if (runSpecsInputs.targetRelativeHalfWidth < 0) {
+			string errorString = "	ERROR - TargetRelativeCIHalfWidth must not be negative";
+			throw errorString;
+		}
+	}
+	runSpecsInputs.convergenceCheckInterval = 1000;
+	if (inputTokens->skipPast("ConvergenceCheckInterval")) {
+		readInt(runSpecsInputs.convergenceCheckInterval);
+		if (runSpecsInputs.convergenceCheckInterval < 1) {
+			string errorString = "	ERROR - ConvergenceCheckInterval must be positive";
+			throw errorString;
+		}
+	}
 	}
 
 /* readCohortInputs reads data from the Cohort tab of the input sheet */
@@ -109,32 +163,32 @@ void SimContext::readCohortInputs() {
 	char buffer[256];
 	int i, j, strata, ageYears, week, tempBool, tempInt;
 	// read Age Mean
-	readAndSkipPast("AgeMean", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.ageMonthsMean);
+	readAndSkipPast("AgeMean");
+	readDouble(cohortInputs.ageMonthsMean);
 	// read Age Std Dev
-	readAndSkipPast("AgeStdDev", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.ageMonthsStdDev);
+	readAndSkipPast("AgeStdDev");
+	readDouble(cohortInputs.ageMonthsStdDev);
 	// read Minimum Age
-	readAndSkipPast("AgeMinimum", inputFile);
-	fscanf(inputFile, "%d", &cohortInputs.minimumAgeMonths);
+	readAndSkipPast("AgeMinimum");
+	readInt(cohortInputs.minimumAgeMonths);
 	// read Maximum Age
-	readAndSkipPast("AgeMaximum", inputFile);
-	fscanf(inputFile, "%d", &cohortInputs.maximumAgeMonths);
+	readAndSkipPast("AgeMaximum");
+	readInt(cohortInputs.maximumAgeMonths);
 	/* read maternal age strata bounds */
-	readAndSkipPast("MaternalAgeStrataBounds", inputFile);
+	readAndSkipPast("MaternalAgeStrataBounds");
 	for (i = 0; i < NUM_AGE_STRATA_BOUNDS; i++) {
-		fscanf(inputFile, "%d", &cohortInputs.maternalAgeStrataBounds[i]);
+		readInt(cohortInputs.maternalAgeStrataBounds[i]);
 	}
 
 	// read last got CMV statistics
-	readAndSkipPast("LastGotActiveCMV", inputFile);
+	readAndSkipPast("LastGotActiveCMV");
 	for (i = 0; i < NUM_LAST_CMV_STRATA; i++) {
-		readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[i], inputFile);
-		fscanf(inputFile, "%lf", &cohortInputs.lastGotActiveCMVByStrata[i]);
+		readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[i]);
+		readDouble(cohortInputs.lastGotActiveCMVByStrata[i]);
 	}
-	readAndSkipPast("NeverCMV", inputFile);
+	readAndSkipPast("NeverCMV");
 
-	fscanf(inputFile, "%lf", &cohortInputs.lastGotActiveCMVByStrata[NUM_LAST_CMV_STRATA]);
+	readDouble(cohortInputs.lastGotActiveCMVByStrata[NUM_LAST_CMV_STRATA]);
 	
 
 	/* setting probabilities to 1 from last age bound to age 100 (guaranteed miscarriage after a certain age)*/
@@ -146,47 +200,47 @@ void SimContext::readCohortInputs() {
 	}
 	
 	/** Probability that previous maternal CMV (from before model star) was a primary infection */
-	readAndSkipPast("LastActiveCMVPrimaryOrSecondary", inputFile);
-	readAndSkipPast("VeryRecentPrimaryOrSecondary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probPrevCMVWasPrimary[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecentPrimaryOrSecondary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probPrevCMVWasPrimary[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecentPrimaryOrSecondary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probPrevCMVWasPrimary[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgoPrimaryOrSecondary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probPrevCMVWasPrimary[LONG_TIME_AGO_CMV]);
+	readAndSkipPast("LastActiveCMVPrimaryOrSecondary");
+	readAndSkipPast("VeryRecentPrimaryOrSecondary");
+	readDouble(cohortInputs.probPrevCMVWasPrimary[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecentPrimaryOrSecondary");
+	readDouble(cohortInputs.probPrevCMVWasPrimary[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecentPrimaryOrSecondary");
+	readDouble(cohortInputs.probPrevCMVWasPrimary[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgoPrimaryOrSecondary");
+	readDouble(cohortInputs.probPrevCMVWasPrimary[LONG_TIME_AGO_CMV]);
 
 
 	/** One-Time CMV Vertical Transmission for mothers who had CMV infection that began before model start */
 	/** Probability of One-Time Vertical Transmission for Primary Maternal Infection*/
-	readAndSkipPast("PrevPrimaryOneTimeVerticalTransmission", inputFile);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[VERY_RECENT_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][VERY_RECENT_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][VERY_RECENT_CMV]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[MEDIUM_RECENT_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][MEDIUM_RECENT_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][MEDIUM_RECENT_CMV]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LESS_RECENT_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][LESS_RECENT_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][LESS_RECENT_CMV]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LONG_TIME_AGO_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][LONG_TIME_AGO_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][LONG_TIME_AGO_CMV]);
+	readAndSkipPast("PrevPrimaryOneTimeVerticalTransmission");
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[VERY_RECENT_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][VERY_RECENT_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][VERY_RECENT_CMV]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[MEDIUM_RECENT_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][MEDIUM_RECENT_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][MEDIUM_RECENT_CMV]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LESS_RECENT_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][LESS_RECENT_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][LESS_RECENT_CMV]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LONG_TIME_AGO_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_PRIMARY][LONG_TIME_AGO_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_PRIMARY][LONG_TIME_AGO_CMV]);
 
 	/** Probability of One-Time Vertical Transmission for Secondary Maternal Infection*/
-	readAndSkipPast("PrevSecondaryOneTimeVerticalTransmission", inputFile);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[VERY_RECENT_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][VERY_RECENT_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][VERY_RECENT_CMV]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[MEDIUM_RECENT_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][MEDIUM_RECENT_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][MEDIUM_RECENT_CMV]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LESS_RECENT_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][LESS_RECENT_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][LESS_RECENT_CMV]);
-	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LONG_TIME_AGO_CMV], inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][LONG_TIME_AGO_CMV]);
-	fscanf(inputFile, "%d", &cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][LONG_TIME_AGO_CMV]);
+	readAndSkipPast("PrevSecondaryOneTimeVerticalTransmission");
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[VERY_RECENT_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][VERY_RECENT_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][VERY_RECENT_CMV]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[MEDIUM_RECENT_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][MEDIUM_RECENT_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][MEDIUM_RECENT_CMV]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LESS_RECENT_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][LESS_RECENT_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][LESS_RECENT_CMV]);
+	readAndSkipPast(SimContext::LAST_GOT_CMV_STRATA_CHAR[LONG_TIME_AGO_CMV]);
+	readDouble(cohortInputs.oneTimeVerticalTransmissionProb[TRUE_SECONDARY][LONG_TIME_AGO_CMV]);
+	readInt(cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_SECONDARY][LONG_TIME_AGO_CMV]);
 
 	// initializing One-Time Vertical Transmission from previous infection probabilities and week numbers to 0 if mother has never had infection.
 	/** Initializing to 0 since these probabilities will never be called, they are just here to preserve the ability for the array to be properly
@@ -203,100 +257,100 @@ void SimContext::readCohortInputs() {
 	cohortInputs.oneTimeVerticalTansmissionWeek[TRUE_NO_INFECTION][LONG_TIME_AGO_CMV] = 0;
 
 	/** Probability of symptomatic maternal CMV infection */
-	readAndSkipPast("ProbSymptomaticMaternalInfection", inputFile);
+	readAndSkipPast("ProbSymptomaticMaternalInfection");
 	cohortInputs.probSymptomsWithPrimaryCMV[PRECONCEPTION] = 0;
 	cohortInputs.probSymptomsWithSecondaryCMV[PRECONCEPTION] = 0;
-	readAndSkipPast("Trimester1Primary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probSymptomsWithPrimaryCMV[TRIMESTER_1]);
-	readAndSkipPast("Trimester1Secondary", inputFile); 
-	fscanf(inputFile, "%lf", &cohortInputs.probSymptomsWithSecondaryCMV[TRIMESTER_1]);
-	readAndSkipPast("Trimester2Primary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probSymptomsWithPrimaryCMV[TRIMESTER_2]);
-	readAndSkipPast("Trimester2Secondary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probSymptomsWithSecondaryCMV[TRIMESTER_2]);
-	readAndSkipPast("Trimester3Primary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probSymptomsWithPrimaryCMV[TRIMESTER_3]);
-	readAndSkipPast("Trimester3Secondary", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probSymptomsWithSecondaryCMV[TRIMESTER_3]);
+	readAndSkipPast("Trimester1Primary");
+	readDouble(cohortInputs.probSymptomsWithPrimaryCMV[TRIMESTER_1]);
+	readAndSkipPast("Trimester1Secondary"); 
+	readDouble(cohortInputs.probSymptomsWithSecondaryCMV[TRIMESTER_1]);
+	readAndSkipPast("Trimester2Primary");
+	readDouble(cohortInputs.probSymptomsWithPrimaryCMV[TRIMESTER_2]);
+	readAndSkipPast("Trimester2Secondary");
+	readDouble(cohortInputs.probSymptomsWithSecondaryCMV[TRIMESTER_2]);
+	readAndSkipPast("Trimester3Primary");
+	readDouble(cohortInputs.probSymptomsWithPrimaryCMV[TRIMESTER_3]);
+	readAndSkipPast("Trimester3Secondary");
+	readDouble(cohortInputs.probSymptomsWithSecondaryCMV[TRIMESTER_3]);
 	// child cohort characteristics
 
-	readAndSkipPast("PeriConception", inputFile);
-	readAndSkipPast("VTFromPrimaryInfection", inputFile);
+	readAndSkipPast("PeriConception");
+	readAndSkipPast("VTFromPrimaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][PRECONCEPTION][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][PRECONCEPTION][i]);
 		cohortInputs.probPhenotypesUponVT[TRUE_NO_INFECTION][PRECONCEPTION][i] = 0; // initialized to 0 to preserve ability for array to be properly indexed by enumerated infection status
 	}
-	readAndSkipPast("VTFromSecondaryInfection", inputFile);
+	readAndSkipPast("VTFromSecondaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][PRECONCEPTION][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][PRECONCEPTION][i]);
 	}
 		
-	readAndSkipPast("Trimester1", inputFile);
-	readAndSkipPast("VTFromPrimaryInfection", inputFile);
+	readAndSkipPast("Trimester1");
+	readAndSkipPast("VTFromPrimaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][TRIMESTER_1][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][TRIMESTER_1][i]);
 		cohortInputs.probPhenotypesUponVT[TRUE_NO_INFECTION][TRIMESTER_1][i] = 0; // initialized to 0 to preserve ability for array to be properly indexed by enumerated infection status
 	}
-	readAndSkipPast("VTFromSecondaryInfection", inputFile);
+	readAndSkipPast("VTFromSecondaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][TRIMESTER_1][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][TRIMESTER_1][i]);
 	}
-	readAndSkipPast("Trimester2", inputFile);
-	readAndSkipPast("VTFromPrimaryInfection", inputFile);
+	readAndSkipPast("Trimester2");
+	readAndSkipPast("VTFromPrimaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][TRIMESTER_2][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][TRIMESTER_2][i]);
 		cohortInputs.probPhenotypesUponVT[TRUE_NO_INFECTION][TRIMESTER_2][i] = 0; // initialized to 0 to preserve ability for array to be properly indexed by enumerated infection status
 	}
-	readAndSkipPast("VTFromSecondaryInfection", inputFile);
+	readAndSkipPast("VTFromSecondaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][TRIMESTER_2][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][TRIMESTER_2][i]);
 	}
-	readAndSkipPast("Trimester3", inputFile);
-	readAndSkipPast("VTFromPrimaryInfection", inputFile);
+	readAndSkipPast("Trimester3");
+	readAndSkipPast("VTFromPrimaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][TRIMESTER_3][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_PRIMARY][TRIMESTER_3][i]);
 		cohortInputs.probPhenotypesUponVT[TRUE_NO_INFECTION][TRIMESTER_3][i] = 0; // initialized to 0 to preserve ability for array to be properly indexed by enumerated infection status
 	}
-	readAndSkipPast("VTFromSecondaryInfection", inputFile);
+	readAndSkipPast("VTFromSecondaryInfection");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][TRIMESTER_3][i]);
+		readDouble(cohortInputs.probPhenotypesUponVT[TRUE_SECONDARY][TRIMESTER_3][i]);
 	}
-	readAndSkipPast("ProbMale", inputFile);
-	fscanf(inputFile, "%lf", &cohortInputs.probMale);
-	readAndSkipPast("EnableCustomAgeDist", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
+	readAndSkipPast("ProbMale");
+	readDouble(cohortInputs.probMale);
+	readAndSkipPast("EnableCustomAgeDist");
+	readInt(tempBool);
 	cohortInputs.enableCustomAgeDist = tempBool;
 	// custom age distribution
 	if (cohortInputs.enableCustomAgeDist) {
 		for (i = 0; i < NUM_CUSTOM_AGE_STRATA; i++) {
 			string searchString = "Stratum" + to_string(i);
-			readAndSkipPast(searchString.c_str(), inputFile);
-			fscanf(inputFile, "%d", &cohortInputs.customAgeDistMonthStrata[i]);
+			readAndSkipPast(searchString.c_str());
+			readInt(cohortInputs.customAgeDistMonthStrata[i]);
 			if (i == NUM_CUSTOM_AGE_STRATA - 1) { // filling in the maximum month for the maximum stratum for the entire distribution
-				fscanf(inputFile, "%d", &cohortInputs.customAgeDistStrataProbs[NUM_CUSTOM_AGE_STRATA]);
+				readDouble(cohortInputs.customAgeDistStrataProbs[NUM_CUSTOM_AGE_STRATA]);
 			}
 			else { // if not at the last stratum, ignore the upper bound, since it can be determined by the subsequent lower bound. 
-				fscanf(inputFile, "%d", &tempInt);
+				readInt(tempInt);
 			}
 			// Read in the probability for the particular stratum. 
-			fscanf(inputFile, "%lf", &cohortInputs.customAgeDistStrataProbs[i]);
+			readDouble(cohortInputs.customAgeDistStrataProbs[i]);
 		}
 	}
 	// low avidty duration
 	cohortInputs.lowAvidityDurationMean = 13;
 	cohortInputs.lowAvidityDurationStdDev = (double)(52/12)*0.5;
 	/** Baseline Probabilities of Premature Birth */
-	readAndSkipPast("WeeklyProbabilityBirth", inputFile);
+	readAndSkipPast("WeeklyProbabilityBirth");
 	// looping over all age ranges
 
 	/** Weekly Probabilities of Birth (no CMV)*/
 	
 	for (week = 0; week < MAX_WEEKS_PREGNANT; week++) { 
 		string weekName = "Week" + to_string(week);
-		readAndSkipPast(weekName.c_str(), inputFile);
+		readAndSkipPast(weekName.c_str());
 		for (strata = 0; strata < NUM_AGE_STRATA; strata++) {
 			double prob;
-			fscanf(inputFile, "%lf", &prob);
+			readDouble(prob);
 			for (ageYears = cohortInputs.maternalAgeStrataBounds[strata]; ageYears < cohortInputs.maternalAgeStrataBounds[strata+1]; ageYears++) {
 				cohortInputs.weeklyProbBirth[ageYears][week] = prob;
 			}
@@ -304,15 +358,15 @@ void SimContext::readCohortInputs() {
 		}
 	}
 	/** CMV Positive Probabilities of Premature Birth*/
-	readAndSkipPast("CMVPositiveWeeklyProbabilityBirth", inputFile);
+	readAndSkipPast("CMVPositiveWeeklyProbabilityBirth");
 	// looping over all age ranges 
 	
 	for (week = 2; week < MAX_WEEKS_PREGNANT; week++) { 
 		string weekName = "Week" + to_string(week);
-		readAndSkipPast(weekName.c_str(), inputFile);
+		readAndSkipPast(weekName.c_str());
 		for (strata = 0; strata < NUM_AGE_STRATA; strata++) {
 			double prob;
-			fscanf(inputFile, "%lf", &prob);
+			readDouble(prob);
 			for (ageYears = cohortInputs.maternalAgeStrataBounds[strata]; ageYears < cohortInputs.maternalAgeStrataBounds[strata+1]; ageYears++) {
 				cohortInputs.CMVPositiveWeeklyProbBirth[ageYears][week] = prob;
 			}
@@ -324,44 +378,44 @@ void SimContext::readCohortInputs() {
 /* readMaternalCohortInputs reads data from the MaternalCohort tab of the input sheet */
 void SimContext::readPrenatalNatHistInputs() {
 	int i, j, week, strata, ageYears;
-	readAndSkipPast("PrenatalNatHist", inputFile);
-	readAndSkipPast("WeeklyPrimaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeklyPrimaryCMV);
-	readAndSkipPast("WeeklySecondaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeklySecondaryCMV);
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeklyProbMildIllness);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeklyProbKnownInfection);
+	readAndSkipPast("PrenatalNatHist");
+	readAndSkipPast("WeeklyPrimaryCMV");
+	readDouble(prenatalNatHistInputs.weeklyPrimaryCMV);
+	readAndSkipPast("WeeklySecondaryCMV");
+	readDouble(prenatalNatHistInputs.weeklySecondaryCMV);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalNatHistInputs.weeklyProbMildIllness);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalNatHistInputs.weeklyProbKnownInfection);
 
 	/** Maternal Biological Markers Timing */
-	readAndSkipPast("TimeToViremiaFromInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToViremiaFromInfectionMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToViremiaFromInfectionStdDev);
-	readAndSkipPast("LengthOfViremia", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.lengthOfViremiaMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.lengthOfViremiaStdDev);
-	readAndSkipPast("TimeToIgMPositiveFromInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToIgmPositiveFromInfectionMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToIgmPositiveFromInfectionStdDev);
-	readAndSkipPast("LengthOfIgMPositivity", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.lengthOfIgmPositivityMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.lengthOfIgmPositivityStdDev);
-	readAndSkipPast("TimeToIgGPositiveFromInfection", inputFile);///
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToIggPositiveFromInfectionMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToIggPositiveFromInfectionStdDev);
-	readAndSkipPast("TimeToLowAvidityFromInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToLowAvidityFromInfectionMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToLowAvidityFromInfectionStdDev);
-	readAndSkipPast("TimeToHighAvidityFromLowAvidity", inputFile);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToHighAvidityFromLowAvidityMean);
-	fscanf(inputFile, "%lf", &prenatalNatHistInputs.weeksToHighAvidityFromLowAvidityStdDev);
-	readAndSkipPast("MaternalInfectionToVerticalTransmissionDelay", inputFile);
-	fscanf(inputFile, "%d", &prenatalNatHistInputs.maternalInfectionToVerticalTransmissionDelay);
-	readAndSkipPast("VerticalTransmissionToDetectableDelay", inputFile);
-	fscanf(inputFile, "%d", &prenatalNatHistInputs.verticalTransmissionToDetectableDelay);
-	
-	//readAndSkipPast("PrimaryMaternalVerticalTransmission", inputFile);
+	readAndSkipPast("TimeToViremiaFromInfection");
+	readDouble(prenatalNatHistInputs.weeksToViremiaFromInfectionMean);
+	readDouble(prenatalNatHistInputs.weeksToViremiaFromInfectionStdDev);
+	readAndSkipPast("LengthOfViremia");
+	readDouble(prenatalNatHistInputs.lengthOfViremiaMean);
+	readDouble(prenatalNatHistInputs.lengthOfViremiaStdDev);
+	readAndSkipPast("TimeToIgMPositiveFromInfection");
+	readDouble(prenatalNatHistInputs.weeksToIgmPositiveFromInfectionMean);
+	readDouble(prenatalNatHistInputs.weeksToIgmPositiveFromInfectionStdDev);
+	readAndSkipPast("LengthOfIgMPositivity");
+	readDouble(prenatalNatHistInputs.lengthOfIgmPositivityMean);
+	readDouble(prenatalNatHistInputs.lengthOfIgmPositivityStdDev);
+	readAndSkipPast("TimeToIgGPositiveFromInfection");///
+	readDouble(prenatalNatHistInputs.weeksToIggPositiveFromInfectionMean);
+	readDouble(prenatalNatHistInputs.weeksToIggPositiveFromInfectionStdDev);
+	readAndSkipPast("TimeToLowAvidityFromInfection");
+	readDouble(prenatalNatHistInputs.weeksToLowAvidityFromInfectionMean);
+	readDouble(prenatalNatHistInputs.weeksToLowAvidityFromInfectionStdDev);
+	readAndSkipPast("TimeToHighAvidityFromLowAvidity");
+	readDouble(prenatalNatHistInputs.weeksToHighAvidityFromLowAvidityMean);
+	readDouble(prenatalNatHistInputs.weeksToHighAvidityFromLowAvidityStdDev);
+	readAndSkipPast("MaternalInfectionToVerticalTransmissionDelay");
+	readInt(prenatalNatHistInputs.maternalInfectionToVerticalTransmissionDelay);
+	readAndSkipPast("VerticalTransmissionToDetectableDelay");
+	readInt(prenatalNatHistInputs.verticalTransmissionToDetectableDelay);
+	
+	//readAndSkipPast("PrimaryMaternalVerticalTransmission");
 	string weekstr = "week";
 	string weekNum;
 	string weekNumName;
@@ -372,12 +426,12 @@ void SimContext::readPrenatalNatHistInputs() {
 		weekNum = std::to_string(i);
 		weekNumName = weekstr + weekNum;
 		weekNumNameChar = weekNumName.c_str();
-		readAndSkipPast(weekNumNameChar, inputFile);
+		readAndSkipPast(weekNumNameChar);
 
-		fscanf(inputFile, "%lf", &prenatalNatHistInputs.childWeeklyPrimaryCMV[i]);
+		readDouble(prenatalNatHistInputs.childWeeklyPrimaryCMV[i]);
 		
 	}
-	readAndSkipPast("SecondaryMaternalVerticalTransmission", inputFile);
+	readAndSkipPast("SecondaryMaternalVerticalTransmission");
 	*/
 	/* looping over child weekly secondary CMV probabilities to add to array */
 	/*
@@ -385,58 +439,58 @@ void SimContext::readPrenatalNatHistInputs() {
 		weekNum = std::to_string(i);
 		weekNumName = weekstr + weekNum;
 		weekNumNameChar = weekNumName.c_str();
-		readAndSkipPast(weekNumNameChar, inputFile);
+		readAndSkipPast(weekNumNameChar);
 
-		fscanf(inputFile, "%lf", &prenatalNatHistInputs.childWeeklySecondaryCMV[i]);
+		readDouble(prenatalNatHistInputs.childWeeklySecondaryCMV[i]);
 		
 	}
 	*/
 	/* reading probabilities of vertical transmission stratified by trimester and primary/secondary infection */
-	readAndSkipPast("PrimaryMaternalVerticalTransmissionByTrimester", inputFile);
+	readAndSkipPast("PrimaryMaternalVerticalTransmissionByTrimester");
 	prenatalNatHistInputs.primaryVerticalTransmission[0] = 0;
 	for (i = 1; i < NUM_TRIMESTERS; i++) {
-		fscanf(inputFile, "%lf", &prenatalNatHistInputs.primaryVerticalTransmission[i]);
+		readDouble(prenatalNatHistInputs.primaryVerticalTransmission[i]);
 		cout << prenatalNatHistInputs.primaryVerticalTransmission[i] << endl;
 	}
 
-	readAndSkipPast("SecondaryMaternalVerticalTransmissionByTrimester", inputFile);
+	readAndSkipPast("SecondaryMaternalVerticalTransmissionByTrimester");
 	prenatalNatHistInputs.secondaryVerticalTransmission[0] = 0;
 	for (i = 1; i < NUM_TRIMESTERS; i++) {
-		fscanf(inputFile, "%lf", &prenatalNatHistInputs.secondaryVerticalTransmission[i]);
+		readDouble(prenatalNatHistInputs.secondaryVerticalTransmission[i]);
 	}
 
 	/* Background Weekly Probability of Miscarriage */
 	// looping over age ranges
-	readAndSkipPast("BackgroundWeeklyProbabilityMiscarriage", inputFile);
+	readAndSkipPast("BackgroundWeeklyProbabilityMiscarriage");
 	for (strata = 0; strata < NUM_AGE_STRATA; strata++) {
 		string ageRange = "AgeRange" + to_string(strata+1);
-		readAndSkipPast(ageRange.c_str(), inputFile);
+		readAndSkipPast(ageRange.c_str());
 		for (week = 2; week < MAX_WEEKS_PREGNANT; week++) { 
 			weekNum = std::to_string(week);
 			weekNumName = "week" + weekNum;
 			weekNumNameChar = weekNumName.c_str();
-			readAndSkipPast(weekNumNameChar, inputFile);
+			readAndSkipPast(weekNumNameChar);
 
 			double prob;
-			fscanf(inputFile, "%lf", &prob);
+			readDouble(prob);
 			for (ageYears = cohortInputs.maternalAgeStrataBounds[strata]; ageYears < cohortInputs.maternalAgeStrataBounds[strata+1]; ageYears++) {
 				prenatalNatHistInputs.backgroundMiscarriage[ageYears][week] = prob;
 			}
 			
 		}
 	}
-	readAndSkipPast("CMVPositiveWeeklyProbabilityMiscarriage", inputFile);
+	readAndSkipPast("CMVPositiveWeeklyProbabilityMiscarriage");
 	/* CMV Positive Weekly Probability of Miscarriage */
 	// looping over age ranges
 	for (strata = 0; strata < NUM_AGE_STRATA; strata++) {
 		string ageRange = "AgeRange" + to_string(strata+1);
-		readAndSkipPast(ageRange.c_str(), inputFile);
+		readAndSkipPast(ageRange.c_str());
 		for (week = 2; week < MAX_WEEKS_PREGNANT; week++) { 
 			string weekName = "week" + to_string(week);
-			readAndSkipPast(weekName.c_str(), inputFile);
+			readAndSkipPast(weekName.c_str());
 
 			double prob;
-			fscanf(inputFile, "%lf", &prob);
+			readDouble(prob);
 			for (ageYears = cohortInputs.maternalAgeStrataBounds[strata]; ageYears < cohortInputs.maternalAgeStrataBounds[strata+1]; ageYears++) {
 				prenatalNatHistInputs.CMVPositiveMiscarriage[ageYears][week] = prob;
 			}
@@ -444,12 +498,12 @@ void SimContext::readPrenatalNatHistInputs() {
 		}
 	}
 
-	readAndSkipPast("FetalDeathRiskDuringBirth", inputFile);
+	readAndSkipPast("FetalDeathRiskDuringBirth");
 	for (week = 0; week < MAX_WEEKS_PREGNANT; week++) {
 		string weekName = "week" + to_string(week);
-		readAndSkipPast(weekName.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalNatHistInputs.fetalDeathRiskDuringBirth[week][CMV_NEGATIVE]);
-		fscanf(inputFile, "%lf", &prenatalNatHistInputs.fetalDeathRiskDuringBirth[week][CMV_POSITIVE]);
+		readAndSkipPast(weekName.c_str());
+		readDouble(prenatalNatHistInputs.fetalDeathRiskDuringBirth[week][CMV_NEGATIVE]);
+		readDouble(prenatalNatHistInputs.fetalDeathRiskDuringBirth[week][CMV_POSITIVE]);
 	}
 }
 
@@ -464,24 +518,24 @@ void SimContext::readHealthcareInteractionsScheduleInputs() {
 	string week = "week";
 	string weekNum, weekNumName;
 	const char* weekNumNameChar;
-	readAndSkipPast("HealthcareInteractionSchedule", inputFile);
+	readAndSkipPast("HealthcareInteractionSchedule");
 
-	readAndSkipPast("ProbSeekingHealthcare", inputFile);
-	readAndSkipPast("SymptomaticCMV", inputFile);
+	readAndSkipPast("ProbSeekingHealthcare");
+	readAndSkipPast("SymptomaticCMV");
 
-	fscanf(inputFile, "%lf", &backgroundScreeningInputs.seekingHealthcareSymptomatic);
+	readDouble(backgroundScreeningInputs.seekingHealthcareSymptomatic);
 
-	readAndSkipPast("MildIllness", inputFile);
+	readAndSkipPast("MildIllness");
 
-	fscanf(inputFile, "%lf", &backgroundScreeningInputs.seekingHealthcareMildIllness);
+	readDouble(backgroundScreeningInputs.seekingHealthcareMildIllness);
 	
-	readAndSkipPast("KnownInfection", inputFile);
+	readAndSkipPast("KnownInfection");
 
-	fscanf(inputFile, "%lf", &backgroundScreeningInputs.seekingHealthcareKnownInfection);
+	readDouble(backgroundScreeningInputs.seekingHealthcareKnownInfection);
 	
-	readAndSkipPast("LikelihoodReportingSymptoms", inputFile);
+	readAndSkipPast("LikelihoodReportingSymptoms");
 
-	fscanf(inputFile, "%d", &backgroundScreeningInputs.probReportingSymptoms);
+	readDouble(backgroundScreeningInputs.probReportingSymptoms);
 
 	/* Regular Background Screening by Week (no CMV diagnoses) */
 
@@ -493,18 +547,18 @@ void SimContext::readHealthcareInteractionsScheduleInputs() {
 	}
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithScheduledAppointments[i] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendingRegularAppointmentsByWeek[i]);
+		readDouble(backgroundScreeningInputs.probAttendingRegularAppointmentsByWeek[i]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.backgroundTesting[i][j] = tempBool;
 		}
 	}
 
 	/* Screening Upon Maternal CMV */
-	readAndSkipPast("ScreeningUponMaternalCMV", inputFile);
+	readAndSkipPast("ScreeningUponMaternalCMV");
 
 	// For week 0, set all inputs to 0, since nothing can happen during week 0.
 	for (i = 0; i < 5; i++) {
@@ -524,61 +578,61 @@ void SimContext::readHealthcareInteractionsScheduleInputs() {
 		}
 	}
 
-	readAndSkipPast("PrimaryMaternalCMV", inputFile);
+	readAndSkipPast("PrimaryMaternalCMV");
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithVisitsUponMaternalDiagnosis[i][PRIMARY] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][PRIMARY]);
+		readDouble(backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][PRIMARY]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.testingUponMaternalDiagnosis[i][j][PRIMARY] = tempBool;
 		}
 	}
 
 
-	readAndSkipPast("SecondaryMaternalCMV", inputFile);
+	readAndSkipPast("SecondaryMaternalCMV");
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithVisitsUponMaternalDiagnosis[i][SECONDARY] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][SECONDARY]);
+		readDouble(backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][SECONDARY]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.testingUponMaternalDiagnosis[i][j][SECONDARY] = tempBool;
 		}
 	}
 
-	readAndSkipPast("RecentUnknownMaternalCMV", inputFile);
+	readAndSkipPast("RecentUnknownMaternalCMV");
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithVisitsUponMaternalDiagnosis[i][RECENT_UNKNOWN] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][RECENT_UNKNOWN]);
+		readDouble(backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][RECENT_UNKNOWN]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.testingUponMaternalDiagnosis[i][j][RECENT_UNKNOWN] = tempBool;
 		}
 	}
 
-	readAndSkipPast("LongAgoUnknownMaternalCMV", inputFile);
+	readAndSkipPast("LongAgoUnknownMaternalCMV");
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithVisitsUponMaternalDiagnosis[i][LONG_AGO_UNKNOWN] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][LONG_AGO_UNKNOWN]);
+		readDouble(backgroundScreeningInputs.probAttendUponMaternalDiagnosis[i][LONG_AGO_UNKNOWN]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.testingUponMaternalDiagnosis[i][j][LONG_AGO_UNKNOWN] = tempBool;
 		}
 	}
 
 	/* Prenatal Screening Upon Fetus/Child Diagnosed With CMV */
-	readAndSkipPast("ScreeningUponChildCMV", inputFile);
+	readAndSkipPast("ScreeningUponChildCMV");
 
 	// For week 0, set all inputs to 0, since nothing can happen during week 0.
 	backgroundScreeningInputs.weeksWithVisitsUponChildDiagnosis[0][ASYMPTOMATIC] = false;
@@ -591,28 +645,28 @@ void SimContext::readHealthcareInteractionsScheduleInputs() {
 	}
 
 
-	readAndSkipPast("AsymptomaticFetalInfection", inputFile);
+	readAndSkipPast("AsymptomaticFetalInfection");
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithVisitsUponChildDiagnosis[i][ASYMPTOMATIC] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendUponChildDiagnosis[i][ASYMPTOMATIC]);
+		readDouble(backgroundScreeningInputs.probAttendUponChildDiagnosis[i][ASYMPTOMATIC]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.testingUponChildDiagnosis[i][j][ASYMPTOMATIC] = tempBool;
 		}
 	}
 
-	readAndSkipPast("SymptomaticFetalInfection", inputFile);
+	readAndSkipPast("SymptomaticFetalInfection");
 	for (i = 1; i < MAX_WEEKS_PREGNANT; i++) {
 		sprintf(tmpBuf, "week%d", i);
-		readAndSkipPast(tmpBuf, inputFile);
-		fscanf(inputFile, "%d", &tempBool);
+		readAndSkipPast(tmpBuf);
+		readInt(tempBool);
 		backgroundScreeningInputs.weeksWithVisitsUponChildDiagnosis[i][SYMPTOMATIC] = tempBool;
-		fscanf(inputFile, "%lf", &backgroundScreeningInputs.probAttendUponChildDiagnosis[i][SYMPTOMATIC]);
+		readDouble(backgroundScreeningInputs.probAttendUponChildDiagnosis[i][SYMPTOMATIC]);
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++) {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			backgroundScreeningInputs.testingUponChildDiagnosis[i][j][SYMPTOMATIC] = tempBool;
 		}
 	}
@@ -635,269 +689,269 @@ void SimContext::readPrenatalTestSpecs() {
 	string weekNum;
 	string weekNumName;
 	const char* weekNumNameChar;
-	readAndSkipPast("PrenatalTestSpecs", inputFile);
+	readAndSkipPast("PrenatalTestSpecs");
 	/* DEFINING INDIVIDUAL PRENATAL TESTS */
 
 	/* Prenatal Test 1 */
 	test = ROUTINE_US;
 
-	readAndSkipPast("PrenatalTest1", inputFile);
+	readAndSkipPast("PrenatalTest1");
 	prenatalTestingInputs.routineUltrasound.testArray = ROUTINE_US;
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.routineUltrasound.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.routineUltrasound.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.routineUltrasound.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.routineUltrasound.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.probOfferedAndAccept);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
+	readDouble(prenatalTestingInputs.routineUltrasound.probOfferedAndAccept);
 	
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.routineUltrasound.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.probResultReturn);
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.weeksToResultReturn);
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.weeksToRepeatTestIfNoReturn);
-	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.notAvailableAfter);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
+	readAndSkipPast("ProbResultReturnToPatient");
+	readDouble(prenatalTestingInputs.routineUltrasound.probResultReturn);
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.routineUltrasound.weeksToResultReturn);
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
+	readInt(prenatalTestingInputs.routineUltrasound.weeksToRepeatTestIfNoReturn);
+	
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.routineUltrasound.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.routineUltrasound.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.routineUltrasound.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.routineUltrasound.notAvailableAfter);
+	readAndSkipPast("SensitivityTrimester1");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.testSensitivity[TRIMESTER_1][i]);
+		readDouble(prenatalTestingInputs.routineUltrasound.testSensitivity[TRIMESTER_1][i]);
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
+	readAndSkipPast("SensitivityTrimester2");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.testSensitivity[TRIMESTER_2][i]);
+		readDouble(prenatalTestingInputs.routineUltrasound.testSensitivity[TRIMESTER_2][i]);
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
+	readAndSkipPast("SensitivityTrimester3");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.testSensitivity[TRIMESTER_3][i]);
-	}
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.testSpecificity[TRIMESTER_3]);
+		readDouble(prenatalTestingInputs.routineUltrasound.testSensitivity[TRIMESTER_3][i]);
+	}
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.routineUltrasound.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.routineUltrasound.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.routineUltrasound.testSpecificity[TRIMESTER_3]);
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.routineUltrasound.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.routineUltrasound.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.routineUltrasound.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
 
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.additionalCostConfirmatoryTest);
+	readDouble(prenatalTestingInputs.routineUltrasound.additionalCostConfirmatoryTest);
 	
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.routineUltrasound.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.routineUltrasound.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
 	
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.routineUltrasound.followUpTestsProbabilities[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.followUpTestsProbabilities[i][ABNORMAL]);
+			readDouble(prenatalTestingInputs.routineUltrasound.followUpTestsProbabilities[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.routineUltrasound.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.routineUltrasound.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.routineUltrasound.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.routineUltrasound.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.routineUltrasound.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.routineUltrasound.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.routineUltrasound.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.routineUltrasound.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.routineUltrasound.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.routineUltrasound.followUpTestDelays[i][NORMAL]);
 		}
 	}
 	
 	
 	/* Prenatal Test 2 */
 	test = DETAILED_US;
-	readAndSkipPast("PrenatalTest2", inputFile);
+	readAndSkipPast("PrenatalTest2");
 	prenatalTestingInputs.detailedUltrasound.testArray = DETAILED_US;
 
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.detailedUltrasound.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.detailedUltrasound.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.detailedUltrasound.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.detailedUltrasound.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.probOfferedAndAccept);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
+	readDouble(prenatalTestingInputs.detailedUltrasound.probOfferedAndAccept);
 	
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.detailedUltrasound.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.probResultReturn);
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.weeksToResultReturn);
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.weeksToRepeatTestIfNoReturn);
-	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.notAvailableAfter);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
+	readAndSkipPast("ProbResultReturnToPatient");
+	readDouble(prenatalTestingInputs.detailedUltrasound.probResultReturn);
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.detailedUltrasound.weeksToResultReturn);
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
+	readInt(prenatalTestingInputs.detailedUltrasound.weeksToRepeatTestIfNoReturn);
+	
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.detailedUltrasound.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.detailedUltrasound.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.detailedUltrasound.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.detailedUltrasound.notAvailableAfter);
+	readAndSkipPast("SensitivityTrimester1");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.testSensitivity[TRIMESTER_1][i]);
+		readDouble(prenatalTestingInputs.detailedUltrasound.testSensitivity[TRIMESTER_1][i]);
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
+	readAndSkipPast("SensitivityTrimester2");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.testSensitivity[TRIMESTER_2][i]);
+		readDouble(prenatalTestingInputs.detailedUltrasound.testSensitivity[TRIMESTER_2][i]);
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
+	readAndSkipPast("SensitivityTrimester3");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.testSensitivity[TRIMESTER_3][i]);
-	}
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.testSpecificity[TRIMESTER_3]);
+		readDouble(prenatalTestingInputs.detailedUltrasound.testSensitivity[TRIMESTER_3][i]);
+	}
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.detailedUltrasound.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.detailedUltrasound.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.detailedUltrasound.testSpecificity[TRIMESTER_3]);
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.additionalCostConfirmatoryTest);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.detailedUltrasound.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.detailedUltrasound.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.detailedUltrasound.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
+	readDouble(prenatalTestingInputs.detailedUltrasound.additionalCostConfirmatoryTest);
 	
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.detailedUltrasound.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.detailedUltrasound.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.detailedUltrasound.followUpTestsProbabilities[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.followUpTestsProbabilities[i][ABNORMAL]);
+			readDouble(prenatalTestingInputs.detailedUltrasound.followUpTestsProbabilities[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.detailedUltrasound.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.detailedUltrasound.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.detailedUltrasound.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.detailedUltrasound.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.detailedUltrasound.followUpTestsProbabilities[i][NORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.detailedUltrasound.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.detailedUltrasound.followUpTestDelays[i][NORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.detailedUltrasound.followUpTestDelays[i][NORMAL]);
 		}
 	}
 
@@ -918,63 +972,63 @@ void SimContext::readPrenatalTestSpecs() {
 		else {
 			string testName = "Test";
 			testName.append(std::to_string(i+1));
-			readAndSkipPast(testName.c_str(), inputFile);
-			readAndSkipPast("AbnormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast(testName.c_str());
+			readAndSkipPast("AbnormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTest[i][j][ABNORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTest[i][j][ABNORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestProbabilities[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
+					readDouble(prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestDelays[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestDelays[i][j][ABNORMAL]);
+					readInt(prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestDelays[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("NormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast("NormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTest[i][j][NORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTest[i][j][NORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestProbabilities[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestProbabilities[i][j][NORMAL]);
+					readDouble(prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestProbabilities[i][j][NORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestDelays[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestDelays[i][j][NORMAL]);
+					readInt(prenatalTestingInputs.detailedUltrasound.FUTriggeredByTestDelays[i][j][NORMAL]);
 				}
 			}
 
@@ -983,134 +1037,134 @@ void SimContext::readPrenatalTestSpecs() {
 	
 	/* Prenatal Test 3 */
 	test = AMNIOCENTESIS;
-	readAndSkipPast("PrenatalTest3", inputFile);
+	readAndSkipPast("PrenatalTest3");
 	prenatalTestingInputs.amniocentesis.testArray = AMNIOCENTESIS;
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.amniocentesis.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.amniocentesis.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.amniocentesis.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.amniocentesis.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.probOfferedAndAccept);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
+	readDouble(prenatalTestingInputs.amniocentesis.probOfferedAndAccept);
 	
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.amniocentesis.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.probResultReturn);
-	
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.weeksToResultReturn);
-
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.weeksToRepeatTestIfNoReturn);
-	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.notAvailableAfter);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
+	readAndSkipPast("ProbResultReturnToPatient");
+	readDouble(prenatalTestingInputs.amniocentesis.probResultReturn);
+	
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.amniocentesis.weeksToResultReturn);
+
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
+	readInt(prenatalTestingInputs.amniocentesis.weeksToRepeatTestIfNoReturn);
+	
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.amniocentesis.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.amniocentesis.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.amniocentesis.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.amniocentesis.notAvailableAfter);
+	readAndSkipPast("SensitivityTrimester1");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.testSensitivity[TRIMESTER_1][i]);
+		readDouble(prenatalTestingInputs.amniocentesis.testSensitivity[TRIMESTER_1][i]);
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
+	readAndSkipPast("SensitivityTrimester2");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.testSensitivity[TRIMESTER_2][i]);
+		readDouble(prenatalTestingInputs.amniocentesis.testSensitivity[TRIMESTER_2][i]);
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
+	readAndSkipPast("SensitivityTrimester3");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
-		fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.testSensitivity[TRIMESTER_3][i]);
+		readDouble(prenatalTestingInputs.amniocentesis.testSensitivity[TRIMESTER_3][i]);
 	}
 	
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.testSpecificity[TRIMESTER_3]);
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.amniocentesis.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.amniocentesis.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.amniocentesis.testSpecificity[TRIMESTER_3]);
 
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.additionalCostConfirmatoryTest);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.amniocentesis.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.amniocentesis.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.amniocentesis.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
+	readDouble(prenatalTestingInputs.amniocentesis.additionalCostConfirmatoryTest);
 	
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.amniocentesis.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.amniocentesis.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.amniocentesis.followUpTestsProbabilities[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.followUpTestsProbabilities[i][ABNORMAL]);
+			readDouble(prenatalTestingInputs.amniocentesis.followUpTestsProbabilities[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.amniocentesis.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.amniocentesis.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.amniocentesis.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.amniocentesis.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.amniocentesis.followUpTestsProbabilities[i][NORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.amniocentesis.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.amniocentesis.followUpTestDelays[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.amniocentesis.followUpTestDelays[i][NORMAL]);
 		}
 	}
 
@@ -1131,63 +1185,63 @@ void SimContext::readPrenatalTestSpecs() {
 		else {
 			string testName = "Test";
 			testName.append(std::to_string(i+1));
-			readAndSkipPast(testName.c_str(), inputFile);
-			readAndSkipPast("AbnormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast(testName.c_str());
+			readAndSkipPast("AbnormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTest[i][j][ABNORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTest[i][j][ABNORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTestProbabilities[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
+					readDouble(prenatalTestingInputs.amniocentesis.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTestDelays[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.FUTriggeredByTestDelays[i][j][ABNORMAL]);
+					readInt(prenatalTestingInputs.amniocentesis.FUTriggeredByTestDelays[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("NormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast("NormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTest[i][j][NORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTest[i][j][NORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTestProbabilities[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.amniocentesis.FUTriggeredByTestProbabilities[i][j][NORMAL]);
+					readDouble(prenatalTestingInputs.amniocentesis.FUTriggeredByTestProbabilities[i][j][NORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.amniocentesis.FUTriggeredByTestDelays[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.amniocentesis.FUTriggeredByTestDelays[i][j][NORMAL]);
+					readInt(prenatalTestingInputs.amniocentesis.FUTriggeredByTestDelays[i][j][NORMAL]);
 				}
 			}
 
@@ -1196,142 +1250,142 @@ void SimContext::readPrenatalTestSpecs() {
 
 	/* Prenatal Test 4 */
 	test = MATERNAL_PCR;
-	readAndSkipPast("PrenatalTest4", inputFile);
+	readAndSkipPast("PrenatalTest4");
 	prenatalTestingInputs.maternalPCR.testArray = MATERNAL_PCR;
 
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.maternalPCR.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.maternalPCR.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.maternalPCR.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.maternalPCR.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
 
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.probOfferedAndAccept);
+	readDouble(prenatalTestingInputs.maternalPCR.probOfferedAndAccept);
 	
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.maternalPCR.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
+	readAndSkipPast("ProbResultReturnToPatient");
 
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.probResultReturn);
+	readDouble(prenatalTestingInputs.maternalPCR.probResultReturn);
 	
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.weeksToResultReturn);
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.maternalPCR.weeksToResultReturn);
 	
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
 
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.weeksToRepeatTestIfNoReturn);
+	readInt(prenatalTestingInputs.maternalPCR.weeksToRepeatTestIfNoReturn);
 	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.notAvailableAfter);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_1][0]);
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.maternalPCR.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.maternalPCR.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.maternalPCR.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.maternalPCR.notAvailableAfter);
+	readAndSkipPast("SensitivityTrimester1");
+	readDouble(prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_1][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_1][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_2][0]);
+	readAndSkipPast("SensitivityTrimester2");
+	readDouble(prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_2][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_2][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_3][0]);
+	readAndSkipPast("SensitivityTrimester3");
+	readDouble(prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_3][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.maternalPCR.testSensitivity[TRIMESTER_3][i] = 0;
 	}
 	
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.testSpecificity[TRIMESTER_3]);
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.maternalPCR.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.maternalPCR.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.maternalPCR.testSpecificity[TRIMESTER_3]);
 
 
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.additionalCostConfirmatoryTest);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.maternalPCR.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.maternalPCR.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.maternalPCR.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
+	readDouble(prenatalTestingInputs.maternalPCR.additionalCostConfirmatoryTest);
 	
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.maternalPCR.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.maternalPCR.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.maternalPCR.followUpTestsProbabilities[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.followUpTestsProbabilities[i][ABNORMAL]);
+			readDouble(prenatalTestingInputs.maternalPCR.followUpTestsProbabilities[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.maternalPCR.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.maternalPCR.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.maternalPCR.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.maternalPCR.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.maternalPCR.followUpTestsProbabilities[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.maternalPCR.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.maternalPCR.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.maternalPCR.followUpTestDelays[i][NORMAL]);
 		}
 	}
 
@@ -1352,63 +1406,63 @@ void SimContext::readPrenatalTestSpecs() {
 		else {
 			string testName = "Test";
 			testName.append(std::to_string(i+1));
-			readAndSkipPast(testName.c_str(), inputFile);
-			readAndSkipPast("AbnormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast(testName.c_str());
+			readAndSkipPast("AbnormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTest[i][j][ABNORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTest[i][j][ABNORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTestProbabilities[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
+					readDouble(prenatalTestingInputs.maternalPCR.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTestDelays[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.FUTriggeredByTestDelays[i][j][ABNORMAL]);
+					readInt(prenatalTestingInputs.maternalPCR.FUTriggeredByTestDelays[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("NormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast("NormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTest[i][j][NORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTest[i][j][NORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTestProbabilities[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.maternalPCR.FUTriggeredByTestProbabilities[i][j][NORMAL]);
+					readDouble(prenatalTestingInputs.maternalPCR.FUTriggeredByTestProbabilities[i][j][NORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.maternalPCR.FUTriggeredByTestDelays[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.maternalPCR.FUTriggeredByTestDelays[i][j][NORMAL]);
+					readInt(prenatalTestingInputs.maternalPCR.FUTriggeredByTestDelays[i][j][NORMAL]);
 				}
 			}
 
@@ -1418,141 +1472,141 @@ void SimContext::readPrenatalTestSpecs() {
 
 	/* Prenatal Test 5 */
 	test = IGM;
-	readAndSkipPast("PrenatalTest5", inputFile);
+	readAndSkipPast("PrenatalTest5");
 	prenatalTestingInputs.igmTest.testArray = IGM;
 
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.igmTest.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.igmTest.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.igmTest.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.igmTest.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.probOfferedAndAccept);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
+	readDouble(prenatalTestingInputs.igmTest.probOfferedAndAccept);
 	
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.igmTest.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.probResultReturn);
-	
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.weeksToResultReturn);
-	
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.weeksToRepeatTestIfNoReturn);
-	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.notAvailableAfter);
-
-	readAndSkipPast("TestSensitivity", inputFile);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_1][0]);
+	readAndSkipPast("ProbResultReturnToPatient");
+	readDouble(prenatalTestingInputs.igmTest.probResultReturn);
+	
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.igmTest.weeksToResultReturn);
+	
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
+	readInt(prenatalTestingInputs.igmTest.weeksToRepeatTestIfNoReturn);
+	
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.igmTest.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.igmTest.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.igmTest.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.igmTest.notAvailableAfter);
+
+	readAndSkipPast("TestSensitivity");
+	readAndSkipPast("SensitivityTrimester1");
+	readDouble(prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_1][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_1][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_2][0]);
+	readAndSkipPast("SensitivityTrimester2");
+	readDouble(prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_2][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_2][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_3][0]);
+	readAndSkipPast("SensitivityTrimester3");
+	readDouble(prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_3][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.igmTest.testSensitivity[TRIMESTER_3][i] = 0;
 	}
-	readAndSkipPast("TestSpecificity", inputFile);
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.testSpecificity[TRIMESTER_3]);
+	readAndSkipPast("TestSpecificity");
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.igmTest.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.igmTest.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.igmTest.testSpecificity[TRIMESTER_3]);
 
 
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.additionalCostConfirmatoryTest);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.igmTest.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.igmTest.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.igmTest.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
+	readDouble(prenatalTestingInputs.igmTest.additionalCostConfirmatoryTest);
 	
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.igmTest.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.igmTest.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.igmTest.followUpTestsProbabilities[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.followUpTestsProbabilities[i][ABNORMAL]);
+			readDouble(prenatalTestingInputs.igmTest.followUpTestsProbabilities[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.igmTest.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.igmTest.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.igmTest.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.igmTest.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.igmTest.followUpTestsProbabilities[i][NORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.igmTest.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.igmTest.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.igmTest.followUpTestDelays[i][NORMAL]);
 		}
 	}
 
@@ -1573,63 +1627,63 @@ void SimContext::readPrenatalTestSpecs() {
 		else {
 			string testName = "Test";
 			testName.append(std::to_string(i+1));
-			readAndSkipPast(testName.c_str(), inputFile);
-			readAndSkipPast("AbnormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast(testName.c_str());
+			readAndSkipPast("AbnormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.igmTest.FUTriggeredByTest[i][j][ABNORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.igmTest.FUTriggeredByTest[i][j][ABNORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.igmTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
+					readDouble(prenatalTestingInputs.igmTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.igmTest.FUTriggeredByTestDelays[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.FUTriggeredByTestDelays[i][j][ABNORMAL]);
+					readInt(prenatalTestingInputs.igmTest.FUTriggeredByTestDelays[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("NormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast("NormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.igmTest.FUTriggeredByTest[i][j][NORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.igmTest.FUTriggeredByTest[i][j][NORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.igmTest.FUTriggeredByTestProbabilities[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.igmTest.FUTriggeredByTestProbabilities[i][j][NORMAL]);
+					readDouble(prenatalTestingInputs.igmTest.FUTriggeredByTestProbabilities[i][j][NORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.igmTest.FUTriggeredByTestDelays[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.igmTest.FUTriggeredByTestDelays[i][j][NORMAL]);
+					readInt(prenatalTestingInputs.igmTest.FUTriggeredByTestDelays[i][j][NORMAL]);
 				}
 			}
 
@@ -1638,139 +1692,139 @@ void SimContext::readPrenatalTestSpecs() {
 	
 	/* Prenatal Test 6 */
 	test = IGG;
-	readAndSkipPast("PrenatalTest6", inputFile);
-	prenatalTestingInputs.avidityTest.testArray = IGG;
+	readAndSkipPast("PrenatalTest6");
+	prenatalTestingInputs.iggTest.testArray = IGG;
 
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.iggTest.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.iggTest.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.iggTest.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.iggTest.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.probOfferedAndAccept);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
+	readDouble(prenatalTestingInputs.iggTest.probOfferedAndAccept);
 	
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.iggTest.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.probResultReturn);
-	
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.weeksToResultReturn);
-	
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.weeksToRepeatTestIfNoReturn);
-	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.notAvailableAfter);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_1][0]);
+	readAndSkipPast("ProbResultReturnToPatient");
+	readDouble(prenatalTestingInputs.iggTest.probResultReturn);
+	
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.iggTest.weeksToResultReturn);
+	
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
+	readInt(prenatalTestingInputs.iggTest.weeksToRepeatTestIfNoReturn);
+	
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.iggTest.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.iggTest.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.iggTest.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.iggTest.notAvailableAfter);
+	readAndSkipPast("SensitivityTrimester1");
+	readDouble(prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_1][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_1][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_2][0]);
+	readAndSkipPast("SensitivityTrimester2");
+	readDouble(prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_2][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_2][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_3][0]);
+	readAndSkipPast("SensitivityTrimester3");
+	readDouble(prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_3][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.iggTest.testSensitivity[TRIMESTER_3][i] = 0;
 	}
 	
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.testSpecificity[TRIMESTER_3]);
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.iggTest.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.iggTest.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.iggTest.testSpecificity[TRIMESTER_3]);
 
 
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.additionalCostConfirmatoryTest);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.iggTest.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.iggTest.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.iggTest.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
+	readDouble(prenatalTestingInputs.iggTest.additionalCostConfirmatoryTest);
 	
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.iggTest.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.iggTest.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.iggTest.followUpTestsProbabilities[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.followUpTestsProbabilities[i][ABNORMAL]);
+			readDouble(prenatalTestingInputs.iggTest.followUpTestsProbabilities[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.iggTest.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.iggTest.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.iggTest.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.iggTest.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.iggTest.followUpTestsProbabilities[i][NORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.iggTest.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.iggTest.followUpTestDelays[i][NORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.iggTest.followUpTestDelays[i][NORMAL]);
 		}
 	}
 
@@ -1788,63 +1842,63 @@ void SimContext::readPrenatalTestSpecs() {
 			testName.append("5Negative");
 		}
 
-		readAndSkipPast(testName.c_str(), inputFile);
-		readAndSkipPast("AbnormalResult", inputFile);
-		readAndSkipPast("Activated", inputFile);
+		readAndSkipPast(testName.c_str());
+		readAndSkipPast("AbnormalResult");
+		readAndSkipPast("Activated");
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 			if (j == (test)) {
 				prenatalTestingInputs.iggTest.FUTriggeredByTest[i][j][ABNORMAL] = false;
 			}
 			else {
-				fscanf(inputFile, "%d", &tempBool);
+				readInt(tempBool);
 				prenatalTestingInputs.iggTest.FUTriggeredByTest[i][j][ABNORMAL] = tempBool;
 			}
 		}
-		readAndSkipPast("ProbFollowUp", inputFile);
+		readAndSkipPast("ProbFollowUp");
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 			if (j == (test)) {
 				prenatalTestingInputs.iggTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL] = 0;
 			}
 			else {
-				fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
+				readDouble(prenatalTestingInputs.iggTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
 			}
 		}
-		readAndSkipPast("SchedulingDelay", inputFile);
+		readAndSkipPast("SchedulingDelay");
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 			if (j == (test)) {
 				prenatalTestingInputs.iggTest.FUTriggeredByTestDelays[i][j][ABNORMAL] = 0;
 			}
 			else {
-				fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.FUTriggeredByTestDelays[i][j][ABNORMAL]);
+				readInt(prenatalTestingInputs.iggTest.FUTriggeredByTestDelays[i][j][ABNORMAL]);
 			}
 		}
-		readAndSkipPast("NormalResult", inputFile);
-		readAndSkipPast("Activated", inputFile);
+		readAndSkipPast("NormalResult");
+		readAndSkipPast("Activated");
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 			if (j == (test)) {
 				prenatalTestingInputs.iggTest.FUTriggeredByTest[i][j][NORMAL] = false;
 			}
 			else {
-				fscanf(inputFile, "%d", &tempBool);
+				readInt(tempBool);
 				prenatalTestingInputs.iggTest.FUTriggeredByTest[i][j][NORMAL] = tempBool;
 			}
 		}
-		readAndSkipPast("ProbFollowUp", inputFile);
+		readAndSkipPast("ProbFollowUp");
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 			if (j == (test)) {
 				prenatalTestingInputs.iggTest.FUTriggeredByTestProbabilities[i][j][NORMAL] = 0;
 			}
 			else {
-				fscanf(inputFile, "%lf", &prenatalTestingInputs.iggTest.FUTriggeredByTestProbabilities[i][j][NORMAL]);
+				readDouble(prenatalTestingInputs.iggTest.FUTriggeredByTestProbabilities[i][j][NORMAL]);
 			}
 		}
-		readAndSkipPast("SchedulingDelay", inputFile);
+		readAndSkipPast("SchedulingDelay");
 		for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 			if (j == (test)) {
 				prenatalTestingInputs.iggTest.FUTriggeredByTestDelays[i][j][NORMAL] = 0;
 			}
 			else {
-				fscanf(inputFile, "%d", &prenatalTestingInputs.iggTest.FUTriggeredByTestDelays[i][j][NORMAL]);
+				readInt(prenatalTestingInputs.iggTest.FUTriggeredByTestDelays[i][j][NORMAL]);
 			}
 		}
 		
@@ -1854,138 +1908,138 @@ void SimContext::readPrenatalTestSpecs() {
 
 	/* Prenatal Test 7 */
 	test = IGG_AVIDITY;
-	readAndSkipPast("PrenatalTest7", inputFile);
+	readAndSkipPast("PrenatalTest7");
 	prenatalTestingInputs.avidityTest.testArray = IGG_AVIDITY;
 
 	/** Special case triggering*/
-	readAndSkipPast("MildIllness", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.mildIllnessTrigger);
-	readAndSkipPast("KnownInfection", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.knownInfectionTrigger);
-	readAndSkipPast("SymptomaticCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.symptomaticCMVTrigger);
-	//readAndSkipPast("PreviousTest", inputFile);
-	//fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.previousTestTrigger);
+	readAndSkipPast("MildIllness");
+	readDouble(prenatalTestingInputs.avidityTest.mildIllnessTrigger);
+	readAndSkipPast("KnownInfection");
+	readDouble(prenatalTestingInputs.avidityTest.knownInfectionTrigger);
+	readAndSkipPast("SymptomaticCMV");
+	readDouble(prenatalTestingInputs.avidityTest.symptomaticCMVTrigger);
+	//readAndSkipPast("PreviousTest");
+	//readInt(prenatalTestingInputs.avidityTest.previousTestTrigger);
 	/** Acceptance of prenatal test*/
-	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest", inputFile);
-	readAndSkipPast("BaselineProbOfferedTest", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.probOfferedAndAccept);
+	readAndSkipPast("OfferAndAcceptanceOfPrenatalTest");
+	readAndSkipPast("BaselineProbOfferedTest");
+	readDouble(prenatalTestingInputs.avidityTest.probOfferedAndAccept);
 
-	readAndSkipPast("PrenatalTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.costOfTest);
+	readAndSkipPast("PrenatalTestCost");
+	readDouble(prenatalTestingInputs.avidityTest.costOfTest);
 	
 	/** Prenatal Test Characteristics */
-	readAndSkipPast("ProbResultReturnToPatient", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.probResultReturn);
-
-	readAndSkipPast("WeeksToResultReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.weeksToResultReturn);
-
-	readAndSkipPast("WeeksToRepeatTestIfNoReturn", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.weeksToRepeatTestIfNoReturn);
-	
-	readAndSkipPast("MinimumTestInterval", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.minimumTestInterval);
-	readAndSkipPast("ProbTerminationUponAbnormalResult", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.probTerminationUponAbnormal);
-	readAndSkipPast("AvailableStartingWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.availableStartingWeek);
-	readAndSkipPast("NotAvailableAfterWeek", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.notAvailableAfter);
-	readAndSkipPast("SensitivityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_1][0]);
+	readAndSkipPast("ProbResultReturnToPatient");
+	readDouble(prenatalTestingInputs.avidityTest.probResultReturn);
+
+	readAndSkipPast("WeeksToResultReturn");
+	readInt(prenatalTestingInputs.avidityTest.weeksToResultReturn);
+
+	readAndSkipPast("WeeksToRepeatTestIfNoReturn");
+	readInt(prenatalTestingInputs.avidityTest.weeksToRepeatTestIfNoReturn);
+	
+	readAndSkipPast("MinimumTestInterval");
+	readInt(prenatalTestingInputs.avidityTest.minimumTestInterval);
+	readAndSkipPast("ProbTerminationUponAbnormalResult");
+	readDouble(prenatalTestingInputs.avidityTest.probTerminationUponAbnormal);
+	readAndSkipPast("AvailableStartingWeek");
+	readInt(prenatalTestingInputs.avidityTest.availableStartingWeek);
+	readAndSkipPast("NotAvailableAfterWeek");
+	readInt(prenatalTestingInputs.avidityTest.notAvailableAfter);
+	readAndSkipPast("SensitivityTrimester1");
+	readDouble(prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_1][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_1][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_2][0]);
+	readAndSkipPast("SensitivityTrimester2");
+	readDouble(prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_2][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_2][i] = 0;
 	}
-	readAndSkipPast("SensitivityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_3][0]);
+	readAndSkipPast("SensitivityTrimester3");
+	readDouble(prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_3][0]);
 	for (i = 1; i < NUM_CMV_PHENOTYPES; i++) {
 		prenatalTestingInputs.avidityTest.testSensitivity[TRIMESTER_3][i] = 0;
 	}
 	
-	readAndSkipPast("SpecificityTrimester1", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.testSpecificity[TRIMESTER_1]);
-	readAndSkipPast("SpecificityTrimester2", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.testSpecificity[TRIMESTER_2]);
-	readAndSkipPast("SpecificityTrimester3", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.testSpecificity[TRIMESTER_3]);
+	readAndSkipPast("SpecificityTrimester1");
+	readDouble(prenatalTestingInputs.avidityTest.testSpecificity[TRIMESTER_1]);
+	readAndSkipPast("SpecificityTrimester2");
+	readDouble(prenatalTestingInputs.avidityTest.testSpecificity[TRIMESTER_2]);
+	readAndSkipPast("SpecificityTrimester3");
+	readDouble(prenatalTestingInputs.avidityTest.testSpecificity[TRIMESTER_3]);
 
 
 	/** Confirmatory testing */
 	
-	readAndSkipPast("ConfirmatoryTesting", inputFile);
-	readAndSkipPast("NumRepeatTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.numRepeatedConfirmatory);
-	readAndSkipPast("ProbSchedulingConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.probSchedulingConfirmatory);
-	readAndSkipPast("WeeksBetweenConfirmatoryTests", inputFile);
-	fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.weeksBetweenConfirmatoryTests);
-	readAndSkipPast("AdditionalConfirmatoryTestCost", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.additionalCostConfirmatoryTest);
+	readAndSkipPast("ConfirmatoryTesting");
+	readAndSkipPast("NumRepeatTests");
+	readInt(prenatalTestingInputs.avidityTest.numRepeatedConfirmatory);
+	readAndSkipPast("ProbSchedulingConfirmatoryTests");
+	readDouble(prenatalTestingInputs.avidityTest.probSchedulingConfirmatory);
+	readAndSkipPast("WeeksBetweenConfirmatoryTests");
+	readInt(prenatalTestingInputs.avidityTest.weeksBetweenConfirmatoryTests);
+	readAndSkipPast("AdditionalConfirmatoryTestCost");
+	readDouble(prenatalTestingInputs.avidityTest.additionalCostConfirmatoryTest);
 	
 	/** Follow Up Testing */
-	readAndSkipPast("FollowUpTestingBaseTest", inputFile);
-	readAndSkipPast("AbnormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("FollowUpTestingBaseTest");
+	readAndSkipPast("AbnormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.avidityTest.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.avidityTest.followUpTests[i][ABNORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.avidityTest.followUpTests[i][ABNORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.followUpTestsProbabilities[i][ABNORMAL] );
+			readDouble(prenatalTestingInputs.avidityTest.followUpTestsProbabilities[i][ABNORMAL] );
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.avidityTest.followUpTestDelays[i][ABNORMAL] = 0;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.followUpTestDelays[i][ABNORMAL]);
+			readInt(prenatalTestingInputs.avidityTest.followUpTestDelays[i][ABNORMAL]);
 		}
 	}
-	readAndSkipPast("NormalResult", inputFile);
-	readAndSkipPast("Activated", inputFile);
+	readAndSkipPast("NormalResult");
+	readAndSkipPast("Activated");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.avidityTest.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &tempBool);
+			readInt(tempBool);
 			prenatalTestingInputs.avidityTest.followUpTests[i][NORMAL] = tempBool;
 		}
 	}
-	readAndSkipPast("ProbFollowUp", inputFile);
+	readAndSkipPast("ProbFollowUp");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.avidityTest.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.followUpTestsProbabilities[i][NORMAL]);
+			readDouble(prenatalTestingInputs.avidityTest.followUpTestsProbabilities[i][NORMAL]);
 		}
 	}
-	readAndSkipPast("SchedulingDelay", inputFile);
+	readAndSkipPast("SchedulingDelay");
 	for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
 		if (i == (test)) {
 			prenatalTestingInputs.avidityTest.followUpTests[i][NORMAL] = false;
 		}
 		else {
-			fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.followUpTestDelays[i][NORMAL]);
+			readInt(prenatalTestingInputs.avidityTest.followUpTestDelays[i][NORMAL]);
 		}
 	}
 
@@ -2006,63 +2060,63 @@ void SimContext::readPrenatalTestSpecs() {
 		else {
 			string testName = "Test";
 			testName.append(std::to_string(i+1));
-			readAndSkipPast(testName.c_str(), inputFile);
-			readAndSkipPast("AbnormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast(testName.c_str());
+			readAndSkipPast("AbnormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.avidityTest.FUTriggeredByTest[i][j][ABNORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.avidityTest.FUTriggeredByTest[i][j][ABNORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.avidityTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
+					readDouble(prenatalTestingInputs.avidityTest.FUTriggeredByTestProbabilities[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.avidityTest.FUTriggeredByTestDelays[i][j][ABNORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.FUTriggeredByTestDelays[i][j][ABNORMAL]);
+					readInt(prenatalTestingInputs.avidityTest.FUTriggeredByTestDelays[i][j][ABNORMAL]);
 				}
 			}
-			readAndSkipPast("NormalResult", inputFile);
-			readAndSkipPast("Activated", inputFile);
+			readAndSkipPast("NormalResult");
+			readAndSkipPast("Activated");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.avidityTest.FUTriggeredByTest[i][j][NORMAL] = false;
 				}
 				else {
-					fscanf(inputFile, "%d", &tempBool);
+					readInt(tempBool);
 					prenatalTestingInputs.avidityTest.FUTriggeredByTest[i][j][NORMAL] = tempBool;
 				}
 			}
-			readAndSkipPast("ProbFollowUp", inputFile);
+			readAndSkipPast("ProbFollowUp");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.avidityTest.FUTriggeredByTestProbabilities[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%lf", &prenatalTestingInputs.avidityTest.FUTriggeredByTestProbabilities[i][j][NORMAL]);
+					readDouble(prenatalTestingInputs.avidityTest.FUTriggeredByTestProbabilities[i][j][NORMAL]);
 				}
 			}
-			readAndSkipPast("SchedulingDelay", inputFile);
+			readAndSkipPast("SchedulingDelay");
 			for (j = 0; j < NUM_PRENATAL_TESTS; j++){
 				if (j == (test)) {
 					prenatalTestingInputs.avidityTest.FUTriggeredByTestDelays[i][j][NORMAL] = 0;
 				}
 				else {
-					fscanf(inputFile, "%d", &prenatalTestingInputs.avidityTest.FUTriggeredByTestDelays[i][j][NORMAL]);
+					readInt(prenatalTestingInputs.avidityTest.FUTriggeredByTestDelays[i][j][NORMAL]);
 				}
 			}
 
@@ -2088,222 +2142,222 @@ void SimContext::readPrenatalTreatmentInputs() {
 	int i, j, tempBool;
 	double tempDouble;
 	/** Reading in treatment policies */
-	readAndSkipPast("PrenatalTreatment", inputFile);
-	readAndSkipPast("NoMaternalOrFetalCMV", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
+	readAndSkipPast("PrenatalTreatment");
+	readAndSkipPast("NoMaternalOrFetalCMV");
+	readInt(tempBool);
 	prenatalTreatmentInputs.treatmentBasedOnPolicy[NO_CMV_DIAGNOSES] = tempBool;
-	fscanf(inputFile, "%d", &prenatalTreatmentInputs.treatmentNumberBasedOnPolicy[NO_CMV_DIAGNOSES]);
-	fscanf(inputFile, "%d", &prenatalTreatmentInputs.treatmentDurationBasedOnPolicy[NO_CMV_DIAGNOSES]);
-	readAndSkipPast("MaternalCMVDiagnosis", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
+	readInt(prenatalTreatmentInputs.treatmentNumberBasedOnPolicy[NO_CMV_DIAGNOSES]);
+	readInt(prenatalTreatmentInputs.treatmentDurationBasedOnPolicy[NO_CMV_DIAGNOSES]);
+	readAndSkipPast("MaternalCMVDiagnosis");
+	readInt(tempBool);
 	prenatalTreatmentInputs.treatmentBasedOnPolicy[MATERNAL_CMV_DIAGNOSIS] = tempBool;
-	fscanf(inputFile, "%d", &prenatalTreatmentInputs.treatmentNumberBasedOnPolicy[MATERNAL_CMV_DIAGNOSIS]);
-	fscanf(inputFile, "%d", &prenatalTreatmentInputs.treatmentDurationBasedOnPolicy[MATERNAL_CMV_DIAGNOSIS]);
-	readAndSkipPast("FetalCMVDiagnosis", inputFile);
-	fscanf(inputFile, "%d", &tempBool);
+	readInt(prenatalTreatmentInputs.treatmentNumberBasedOnPolicy[MATERNAL_CMV_DIAGNOSIS]);
+	readInt(prenatalTreatmentInputs.treatmentDurationBasedOnPolicy[MATERNAL_CMV_DIAGNOSIS]);
+	readAndSkipPast("FetalCMVDiagnosis");
+	readInt(tempBool);
 	prenatalTreatmentInputs.treatmentBasedOnPolicy[FETAL_CMV_DIAGNOSIS] = tempBool;
-	fscanf(inputFile, "%d", &prenatalTreatmentInputs.treatmentNumberBasedOnPolicy[FETAL_CMV_DIAGNOSIS]);
-	fscanf(inputFile, "%d", &prenatalTreatmentInputs.treatmentDurationBasedOnPolicy[FETAL_CMV_DIAGNOSIS]);
+	readInt(prenatalTreatmentInputs.treatmentNumberBasedOnPolicy[FETAL_CMV_DIAGNOSIS]);
+	readInt(prenatalTreatmentInputs.treatmentDurationBasedOnPolicy[FETAL_CMV_DIAGNOSIS]);
 
 
 	/** Reading in inputs for individual Prenatal Treatment */
-	readAndSkipPast("PrenatalTreatment1", inputFile);
-	readAndSkipPast("CostPerWeek", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.costPerWeek);
-	readAndSkipPast("WeeklyPrimaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklyPrimaryCMV);
-	
-	readAndSkipPast("PercentSymptomatic", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklyPrimaryProportionSymptomatic);
-	
-	readAndSkipPast("WeeklySecondaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklySecondaryCMV);
-
-	readAndSkipPast("PercentSymptomatic", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklySecondaryProportionSymptomatic);
-	
-	readAndSkipPast("ReductionOfVTFromPrevPrimaryMaternalInfection", inputFile);
-	readAndSkipPast("VeryRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgo", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[LONG_TIME_AGO_CMV]);
-
-	readAndSkipPast("ReductionOfVTFromPrevSecondaryMaternalInfection", inputFile);
-	readAndSkipPast("VeryRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgo", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[LONG_TIME_AGO_CMV]);
-
-	readAndSkipPast("ReductionOfVerticalTransmissionFromPrimaryCMV", inputFile);
+	readAndSkipPast("PrenatalTreatment1");
+	readAndSkipPast("CostPerWeek");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.costPerWeek);
+	readAndSkipPast("WeeklyPrimaryCMV");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklyPrimaryCMV);
+	
+	readAndSkipPast("PercentSymptomatic");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklyPrimaryProportionSymptomatic);
+	
+	readAndSkipPast("WeeklySecondaryCMV");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklySecondaryCMV);
+
+	readAndSkipPast("PercentSymptomatic");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfWeeklySecondaryProportionSymptomatic);
+	
+	readAndSkipPast("ReductionOfVTFromPrevPrimaryMaternalInfection");
+	readAndSkipPast("VeryRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgo");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromPrimaryCMV[LONG_TIME_AGO_CMV]);
+
+	readAndSkipPast("ReductionOfVTFromPrevSecondaryMaternalInfection");
+	readAndSkipPast("VeryRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgo");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfPreviousVTFromSecondaryCMV[LONG_TIME_AGO_CMV]);
+
+	readAndSkipPast("ReductionOfVerticalTransmissionFromPrimaryCMV");
 	// zeroing out reduction for weeks 0 and 1 because no events occur. 
 	for (i = 0; i < MAX_WEEKS_PREGNANT; i++) {
 		string weekStr = "Week";
 		weekStr.append(std::to_string(i));
-		readAndSkipPast(weekStr.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfVerticalTransmissionFromPrimaryCMV[i]);
+		readAndSkipPast(weekStr.c_str());
+		readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfVerticalTransmissionFromPrimaryCMV[i]);
 		
 	}
-	readAndSkipPast("ReductionOfVerticalTransmissionFromSecondaryCMV", inputFile);
+	readAndSkipPast("ReductionOfVerticalTransmissionFromSecondaryCMV");
 
 	for (i = 0; i < MAX_WEEKS_PREGNANT; i++) {
 		string weekStr = "Week";
 		weekStr.append(std::to_string(i));
-		readAndSkipPast(weekStr.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfVerticalTransmissionFromSecondaryCMV[i]);
+		readAndSkipPast(weekStr.c_str());
+		readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfVerticalTransmissionFromSecondaryCMV[i]);
 		
 	}
 	/** Reduction of prenatalTreatment1 symptoms/phenotypes*/
-	readAndSkipPast("ProbSwitching", inputFile);
+	readAndSkipPast("ProbSwitching");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
 		string toType = "ToType";
 		toType.append(std::to_string(i+1));
-		readAndSkipPast(toType.c_str(), inputFile);
-		readAndSkipPast("-", inputFile);
+		readAndSkipPast(toType.c_str());
+		readAndSkipPast("-");
 		prenatalTreatmentInputs.prenatalTreatment1.reductionOfSymptoms[0][i] = 0;
 		for (j = 1; j < NUM_CMV_PHENOTYPES; j++) {
-			fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment1.reductionOfSymptoms[j][i]);
+			readDouble(prenatalTreatmentInputs.prenatalTreatment1.reductionOfSymptoms[j][i]);
 		}
 	}
 
 	/** Prenatal Treatment 2 */
-	readAndSkipPast("PrenatalTreatment2", inputFile);
-	readAndSkipPast("CostPerWeek", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.costPerWeek);
-	readAndSkipPast("WeeklyPrimaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklyPrimaryCMV);
-	
-	readAndSkipPast("PercentSymptomatic", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklyPrimaryProportionSymptomatic);
-	
-	readAndSkipPast("WeeklySecondaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklySecondaryCMV);
-	
-	readAndSkipPast("PercentSymptomatic", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklySecondaryProportionSymptomatic);
-	
-	readAndSkipPast("ReductionOfVTFromPrevPrimaryMaternalInfection", inputFile);
-	readAndSkipPast("VeryRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgo", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[LONG_TIME_AGO_CMV]);
-
-	readAndSkipPast("ReductionOfVTFromPrevSecondaryMaternalInfection", inputFile);
-	readAndSkipPast("VeryRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgo", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[LONG_TIME_AGO_CMV]);
-
-	readAndSkipPast("ReductionOfVerticalTransmissionFromPrimaryCMV", inputFile);
+	readAndSkipPast("PrenatalTreatment2");
+	readAndSkipPast("CostPerWeek");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.costPerWeek);
+	readAndSkipPast("WeeklyPrimaryCMV");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklyPrimaryCMV);
+	
+	readAndSkipPast("PercentSymptomatic");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklyPrimaryProportionSymptomatic);
+	
+	readAndSkipPast("WeeklySecondaryCMV");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklySecondaryCMV);
+	
+	readAndSkipPast("PercentSymptomatic");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfWeeklySecondaryProportionSymptomatic);
+	
+	readAndSkipPast("ReductionOfVTFromPrevPrimaryMaternalInfection");
+	readAndSkipPast("VeryRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgo");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromPrimaryCMV[LONG_TIME_AGO_CMV]);
+
+	readAndSkipPast("ReductionOfVTFromPrevSecondaryMaternalInfection");
+	readAndSkipPast("VeryRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgo");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfPreviousVTFromSecondaryCMV[LONG_TIME_AGO_CMV]);
+
+	readAndSkipPast("ReductionOfVerticalTransmissionFromPrimaryCMV");
 
 	for (i = 0; i < MAX_WEEKS_PREGNANT; i++) {
 		string weekStr = "Week";
 		weekStr.append(std::to_string(i));
-		readAndSkipPast(weekStr.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfVerticalTransmissionFromPrimaryCMV[i]);
+		readAndSkipPast(weekStr.c_str());
+		readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfVerticalTransmissionFromPrimaryCMV[i]);
 		
 	}
-	readAndSkipPast("ReductionOfVerticalTransmissionFromSecondaryCMV", inputFile);
+	readAndSkipPast("ReductionOfVerticalTransmissionFromSecondaryCMV");
 
 	for (i = 2; i < MAX_WEEKS_PREGNANT; i++) {
 		string weekStr = "Week";
 		weekStr.append(std::to_string(i));
-		readAndSkipPast(weekStr.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfVerticalTransmissionFromSecondaryCMV[i]);
+		readAndSkipPast(weekStr.c_str());
+		readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfVerticalTransmissionFromSecondaryCMV[i]);
 		
 	}
 	/** Reduction of prenatalTreatment2 symptoms/phenotypes*/
-	readAndSkipPast("ProbSwitching", inputFile);
+	readAndSkipPast("ProbSwitching");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
 		string toType = "ToType";
 		toType.append(std::to_string(i+1));
-		readAndSkipPast(toType.c_str(), inputFile);
-		readAndSkipPast("-", inputFile);
+		readAndSkipPast(toType.c_str());
+		readAndSkipPast("-");
 		prenatalTreatmentInputs.prenatalTreatment2.reductionOfSymptoms[0][i] = 0;
 		for (j = 1; j < NUM_CMV_PHENOTYPES; j++) {
-			fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment2.reductionOfSymptoms[j][i]);
+			readDouble(prenatalTreatmentInputs.prenatalTreatment2.reductionOfSymptoms[j][i]);
 		}
 	}
 
 	/** Prenatal Treatment 3 */
-	readAndSkipPast("PrenatalTreatment3", inputFile);
-	readAndSkipPast("CostPerWeek", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.costPerWeek);
-	readAndSkipPast("WeeklyPrimaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklyPrimaryCMV);
-	
-	readAndSkipPast("PercentSymptomatic", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklyPrimaryProportionSymptomatic);
-	
-	readAndSkipPast("WeeklySecondaryCMV", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklySecondaryCMV);
-
-	readAndSkipPast("PercentSymptomatic", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklySecondaryProportionSymptomatic);
-	
-	readAndSkipPast("ReductionOfVTFromPrevPrimaryMaternalInfection", inputFile);
-	readAndSkipPast("VeryRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgo", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[LONG_TIME_AGO_CMV]);
-
-	readAndSkipPast("ReductionOfVTFromPrevSecondaryMaternalInfection", inputFile);
-	readAndSkipPast("VeryRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[VERY_RECENT_CMV]);
-	readAndSkipPast("MediumRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[MEDIUM_RECENT_CMV]);
-	readAndSkipPast("LessRecent", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[LESS_RECENT_CMV]);
-	readAndSkipPast("LongTimeAgo", inputFile);
-	fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[LONG_TIME_AGO_CMV]);
-
-	readAndSkipPast("ReductionOfVerticalTransmissionFromPrimaryCMV", inputFile);
+	readAndSkipPast("PrenatalTreatment3");
+	readAndSkipPast("CostPerWeek");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.costPerWeek);
+	readAndSkipPast("WeeklyPrimaryCMV");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklyPrimaryCMV);
+	
+	readAndSkipPast("PercentSymptomatic");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklyPrimaryProportionSymptomatic);
+	
+	readAndSkipPast("WeeklySecondaryCMV");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklySecondaryCMV);
+
+	readAndSkipPast("PercentSymptomatic");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfWeeklySecondaryProportionSymptomatic);
+	
+	readAndSkipPast("ReductionOfVTFromPrevPrimaryMaternalInfection");
+	readAndSkipPast("VeryRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgo");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromPrimaryCMV[LONG_TIME_AGO_CMV]);
+
+	readAndSkipPast("ReductionOfVTFromPrevSecondaryMaternalInfection");
+	readAndSkipPast("VeryRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[VERY_RECENT_CMV]);
+	readAndSkipPast("MediumRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[MEDIUM_RECENT_CMV]);
+	readAndSkipPast("LessRecent");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[LESS_RECENT_CMV]);
+	readAndSkipPast("LongTimeAgo");
+	readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfPreviousVTFromSecondaryCMV[LONG_TIME_AGO_CMV]);
+
+	readAndSkipPast("ReductionOfVerticalTransmissionFromPrimaryCMV");
 
 	for (i = 0; i < MAX_WEEKS_PREGNANT; i++) {
 		string weekStr = "Week";
 		weekStr.append(std::to_string(i));
-		readAndSkipPast(weekStr.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfVerticalTransmissionFromPrimaryCMV[i]);
+		readAndSkipPast(weekStr.c_str());
+		readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfVerticalTransmissionFromPrimaryCMV[i]);
 
 	}
-	readAndSkipPast("ReductionOfVerticalTransmissionFromSecondaryCMV", inputFile);
+	readAndSkipPast("ReductionOfVerticalTransmissionFromSecondaryCMV");
 
 	for (i = 0; i < MAX_WEEKS_PREGNANT; i++) {
 		string weekStr = "Week";
 		weekStr.append(std::to_string(i));
-		readAndSkipPast(weekStr.c_str(), inputFile);
-		fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfVerticalTransmissionFromSecondaryCMV[i]);
+		readAndSkipPast(weekStr.c_str());
+		readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfVerticalTransmissionFromSecondaryCMV[i]);
 		
 	}
 	/** Reduction of prenatalTreatment3 symptoms/phenotypes*/
-	readAndSkipPast("ProbSwitching", inputFile);
+	readAndSkipPast("ProbSwitching");
 	for (i = 0; i < NUM_CMV_PHENOTYPES; i++) {
 		string toType = "ToType";
 		toType.append(std::to_string(i+1));
-		readAndSkipPast(toType.c_str(), inputFile);
-		readAndSkipPast("-", inputFile);
+		readAndSkipPast(toType.c_str());
+		readAndSkipPast("-");
 		prenatalTreatmentInputs.prenatalTreatment3.reductionOfSymptoms[0][i] = 0;
 		for (j = 1; j < NUM_CMV_PHENOTYPES; j++) {
-			fscanf(inputFile, "%lf", &prenatalTreatmentInputs.prenatalTreatment3.reductionOfSymptoms[j][i]);
+			readDouble(prenatalTreatmentInputs.prenatalTreatment3.reductionOfSymptoms[j][i]);
 		}
 	}
 
@@ -2329,30 +2383,550 @@ void SimContext::readAdultInputs() {
 
 }
 
-bool SimContext::readAndSkipPast(const char* searchStr, FILE* file) {
-	char temp[513];
-	fscanf(file, "%512s", temp);
-	while ( strcmp(temp, searchStr) != 0 ) {
+/* buildDistributions precomputes the discrete distributions sampled every week so that draws do not rebuild them */
+void SimContext::buildDistributions() {
+	int i, j, ageYears, week;
+	cohortInputs.lastGotActiveCMVDist.setProbs(cohortInputs.lastGotActiveCMVByStrata, NUM_LAST_CMV_STRATA + 1);
+	for (i = 0; i < NUM_INDX_TRUE_PRIMARY_SECONDARY_NONE; i++) {
+		for (j = 0; j < NUM_TRIMESTERS; j++) {
+			cohortInputs.phenotypesUponVTDist[i][j].setProbs(cohortInputs.probPhenotypesUponVT[i][j], NUM_CMV_PHENOTYPES);
+		}
+	}
+
+	/* Weekly pregnancy outcome in the order miscarriage, birth, continue; delivery is truncated if the two sum past 1 */
+	for (ageYears = 0; ageYears < AGE_YEARS; ageYears++) {
+		for (week = 0; week < MAX_WEEKS_PREGNANT; week++) {
+			for (i = CMV_NEGATIVE; i <= CMV_POSITIVE; i++) {
+				double probMiscarriage = prenatalNatHistInputs.backgroundMiscarriage[ageYears][week];
+				double probDelivery = cohortInputs.weeklyProbBirth[ageYears][week];
+				if (i == CMV_POSITIVE) {
+					probMiscarriage = prenatalNatHistInputs.CMVPositiveMiscarriage[ageYears][week];
+					probDelivery = cohortInputs.CMVPositiveWeeklyProbBirth[ageYears][week];
+				}
+				double probContinue = 1 - probMiscarriage - probDelivery;
+				if (probMiscarriage + probDelivery > 1) {
+					probDelivery = 1 - probMiscarriage;
+					probContinue = 0;
+				}
+				double outcomeProbs[3] = {probMiscarriage, probDelivery, probContinue};
+				prenatalNatHistInputs.pregnancyOutcomeDist[ageYears][week][i].setProbs(outcomeProbs, 3);
+			}
+		}
+	}
 
-		fscanf(file, "%512s", temp);
+	for (i = 0; i < prenatalTreatmentInputs.PrenatalTreatmentsVector.size(); i++) {
+		PrenatalTreatmentInputs::PrenatalTreatment &treatment = prenatalTreatmentInputs.PrenatalTreatmentsVector[i];
+		for (j = 0; j < NUM_CMV_PHENOTYPES; j++) {
+			treatment.reductionOfSymptomsDist[j].setProbs(treatment.reductionOfSymptoms[j], NUM_CMV_PHENOTYPES);
+		}
+	}
+} /* end buildDistributions */
 
-		if ( feof(file) ) {
-			if(counter<=100){
-			printf("\nWARNING: unexpected end of input file. Looking for %s \n",searchStr);
-			counter++;
+/* buildTestingMasks precomputes, for each week, the set of prenatal tests available and the sets scheduled at a visit
+in each monitoring state, so that building a week's test list is a few mask operations */
+void SimContext::buildTestingMasks() {
+	int i, j, week;
+	for (week = 0; week < MAX_WEEKS_PREGNANT; week++) {
+		backgroundScreeningInputs.availableTestsMask[week] = 0;
+		backgroundScreeningInputs.backgroundTestingMask[week] = 0;
+		for (j = 0; j < 5; j++) {
+			backgroundScreeningInputs.testingUponMaternalDiagnosisMask[week][j] = 0;
+		}
+		for (j = 0; j < 2; j++) {
+			backgroundScreeningInputs.testingUponChildDiagnosisMask[week][j] = 0;
+		}
+		for (i = 0; i < NUM_PRENATAL_TESTS; i++) {
+			PrenatalTestMask testBit = (PrenatalTestMask) (1 << i);
+			if (i < prenatalTestingInputs.PrenatalTestsVector.size() && week >= prenatalTestingInputs.PrenatalTestsVector[i].availableStartingWeek &&
+				week < prenatalTestingInputs.PrenatalTestsVector[i].notAvailableAfter) {
+				backgroundScreeningInputs.availableTestsMask[week] |= testBit;
+			}
+			if (backgroundScreeningInputs.backgroundTesting[week][i]) {
+				backgroundScreeningInputs.backgroundTestingMask[week] |= testBit;
+			}
+			for (j = 0; j < 5; j++) {
+				if (backgroundScreeningInputs.testingUponMaternalDiagnosis[week][i][j]) {
+					backgroundScreeningInputs.testingUponMaternalDiagnosisMask[week][j] |= testBit;
+				}
+			}
+			for (j = 0; j < 2; j++) {
+				if (backgroundScreeningInputs.testingUponChildDiagnosis[week][i][j]) {
+					backgroundScreeningInputs.testingUponChildDiagnosisMask[week][j] |= testBit;
+				}
 			}
-
-			return false;
 		}
+	}
+} /* end buildTestingMasks */
+
+/* Binary input cache header: tag, format version, hash of the .in contents, and the size of each inputs class so a
+cache written by a build with a different layout is never loaded. Bump INPUT_CACHE_VERSION whenever transferInputs changes or
+any input is parsed differently, since a cache of the old values would otherwise still match the .in contents and layout. */
+static const char INPUT_CACHE_TAG[8] = {'L', 'I', 'N', 'C', 'S', 'I', 'N', 'B'};
+static const unsigned int INPUT_CACHE_VERSION = 7;
 
+struct InputCacheHeader {
+	char tag[8];
+	unsigned int version;
+	unsigned long long inputHash;
+	unsigned long long layoutSizes[6];
+};
+
+/* InputCacheWriter appends the inputs to a byte buffer, used with SimContext::transferInputs */
+class InputCacheWriter {
+public:
+	string buffer;
+	bool ok = true;
+	template <class T> void transfer(T &value) {
+		static_assert(std::is_trivially_copyable<T>::value, "input cache can only copy plain data");
+		buffer.append((const char *) &value, sizeof(T));
+	}
+	void transferString(string &value) {
+		unsigned long long length = value.size();
+		transfer(length);
+		buffer.append(value);
 	}
-	return true;
+	void transferCount(size_t &count, size_t maxCount) {
+		unsigned long long value = count;
+		transfer(value);
+	}
+};
+
+/* InputCacheReader reads the inputs back out of a cache buffer, used with SimContext::transferInputs; ok is cleared
+if the buffer runs out or holds an impossible value */
+class InputCacheReader {
+public:
+	const char *pos;
+	const char *end;
+	bool ok = true;
+	template <class T> void transfer(T &value) {
+		static_assert(std::is_trivially_copyable<T>::value, "input cache can only copy plain data");
+		if (!ok || (size_t)(end - pos) < sizeof(T)) {
+			ok = false;
+			return;
+		}
+		memcpy(&value, pos, sizeof(T));
+		pos += sizeof(T);
+	}
+	void transferString(string &value) {
+		unsigned long long length = 0;
+		transfer(length);
+		if (!ok || (unsigned long long)(end - pos) < length) {
+			ok = false;
+			return;
+		}
+		value.assign(pos, length);
+		pos += length;
+	}
+	void transferCount(size_t &count, size_t maxCount) {
+		unsigned long long value = 0;
+		transfer(value);
+		if (value > maxCount)
+			ok = false;
+		count = ok ? value : 0;
+	}
+};
+
+/* transferInputs passes every cached input field through the archive, in a fixed order; runName is not cached
+since it comes from the input file name */
+template <class Archive> void SimContext::transferInputs(Archive &archive) {
+	int i;
+	archive.transferString(runSpecsInputs.runSetName);
+	archive.transfer(runSpecsInputs.numCohorts);
+	archive.transfer(runSpecsInputs.annualDiscountFactor);
+	archive.transfer(runSpecsInputs.weeklyDiscountFactor);
+	archive.transfer(runSpecsInputs.monthlyDiscountFactor);
+	archive.transfer(runSpecsInputs.randomSeedByTime);
+	archive.transfer(runSpecsInputs.lastActiveCMVStrataBounds);
+	archive.transfer(runSpecsInputs.numberOfPatientsToTrace);
+	archive.transfer(runSpecsInputs.antitheticPairs);
+	archive.transfer(runSpecsInputs.infectionBiasFactor);
+	archive.transfer(runSpecsInputs.targetRelativeHalfWidth);
+	archive.transfer(runSpecsInputs.convergenceCheckInterval);
+	archive.transferString(runSpecsInputs.userProgramLocale);
+	archive.transferString(runSpecsInputs.inputVersion);
+	archive.transferString(runSpecsInputs.modelVersion);
+	archive.transfer(runSpecsInputs.weekSwitchToMonth);
+
+	archive.transfer(cohortInputs);
+	archive.transfer(prenatalNatHistInputs);
+	archive.transfer(backgroundScreeningInputs);
+
+	transferPrenatalTest(archive, prenatalTestingInputs.routineUltrasound);
+	transferPrenatalTest(archive, prenatalTestingInputs.detailedUltrasound);
+	transferPrenatalTest(archive, prenatalTestingInputs.amniocentesis);
+	transferPrenatalTest(archive, prenatalTestingInputs.maternalPCR);
+	transferPrenatalTest(archive, prenatalTestingInputs.igmTest);
+	transferPrenatalTest(archive, prenatalTestingInputs.iggTest);
+	transferPrenatalTest(archive, prenatalTestingInputs.avidityTest);
+	size_t numTests = prenatalTestingInputs.PrenatalTestsVector.size();
+	archive.transferCount(numTests, NUM_PRENATAL_TESTS);
+	prenatalTestingInputs.PrenatalTestsVector.resize(numTests);
+	for (i = 0; i < numTests; i++) {
+		transferPrenatalTest(archive, prenatalTestingInputs.PrenatalTestsVector[i]);
+	}
+
+	archive.transfer(prenatalTreatmentInputs.treatmentBasedOnPolicy);
+	archive.transfer(prenatalTreatmentInputs.treatmentNumberBasedOnPolicy);
+	archive.transfer(prenatalTreatmentInputs.treatmentDurationBasedOnPolicy);
+	archive.transfer(prenatalTreatmentInputs.prenatalTreatment1);
+	archive.transfer(prenatalTreatmentInputs.prenatalTreatment2);
+	archive.transfer(prenatalTreatmentInputs.prenatalTreatment3);
+	size_t numTreatments = prenatalTreatmentInputs.PrenatalTreatmentsVector.size();
+	archive.transferCount(numTreatments, NUM_TREATMENTS);
+	prenatalTreatmentInputs.PrenatalTreatmentsVector.resize(numTreatments);
+	for (i = 0; i < numTreatments; i++) {
+		archive.transfer(prenatalTreatmentInputs.PrenatalTreatmentsVector[i]);
+	}
+} /* end transferInputs */
+
+/* transferPrenatalTest passes every field of a prenatal test through the archive */
+template <class Archive> void SimContext::transferPrenatalTest(Archive &archive, PrenatalTestingInputs::PrenatalTest &test) {
+	archive.transfer(test.enableTest);
+	archive.transferString(test.testName);
+	archive.transfer(test.testArray);
+	archive.transfer(test.mildIllnessTrigger);
+	archive.transfer(test.knownInfectionTrigger);
+	archive.transfer(test.symptomaticCMVTrigger);
+	archive.transfer(test.previousTestTrigger);
+	archive.transfer(test.probOfferedAndAccept);
+	archive.transfer(test.costOfTest);
+	archive.transfer(test.probResultReturn);
+	archive.transfer(test.weeksToResultReturn);
+	archive.transfer(test.weeksToRepeatTestIfNoReturn);
+	archive.transfer(test.minimumTestInterval);
+	archive.transfer(test.probTerminationUponAbnormal);
+	archive.transfer(test.availableStartingWeek);
+	archive.transfer(test.notAvailableAfter);
+	archive.transfer(test.testSensitivity);
+	archive.transfer(test.testSpecificity);
+	archive.transfer(test.numRepeatedConfirmatory);
+	archive.transfer(test.probSchedulingConfirmatory);
+	archive.transfer(test.weeksBetweenConfirmatoryTests);
+	archive.transfer(test.additionalCostConfirmatoryTest);
+	archive.transfer(test.followUpTests);
+	archive.transfer(test.followUpTestsProbabilities);
+	archive.transfer(test.followUpTestDelays);
+	archive.transfer(test.FUTriggeredByTest);
+	archive.transfer(test.FUTriggeredByTestProbabilities);
+	archive.transfer(test.FUTriggeredByTestDelays);
+} /* end transferPrenatalTest */
+
+/* fillInputCacheHeader sets the header expected for a cache of the given input contents */
+static void fillInputCacheHeader(InputCacheHeader &header, unsigned long long inputHash) {
+	memset(&header, 0, sizeof(header));
+	memcpy(header.tag, INPUT_CACHE_TAG, sizeof(header.tag));
+	header.version = INPUT_CACHE_VERSION;
+	header.inputHash = inputHash;
+	header.layoutSizes[0] = sizeof(SimContext::RunSpecsInputs);
+	header.layoutSizes[1] = sizeof(SimContext::CohortInputs);
+	header.layoutSizes[2] = sizeof(SimContext::PrenatalNatHistInputs);
+	header.layoutSizes[3] = sizeof(SimContext::BackgroundScreeningInputs);
+	header.layoutSizes[4] = sizeof(SimContext::PrenatalTestingInputs::PrenatalTest);
+	header.layoutSizes[5] = sizeof(SimContext::PrenatalTreatmentInputs::PrenatalTreatment);
+}
+
+/* readInputsCache loads all the inputs from the binary cache with a single read; returns false, leaving the text
+inputs to be parsed, if the cache is missing, stale, or unreadable */
+bool SimContext::readInputsCache(const string &cacheFileName, unsigned long long inputHash) {
+	string cacheContents;
+	if (!CmvUtil::readFileContents(cacheFileName.c_str(), cacheContents))
+		return false;
+	InputCacheHeader expectedHeader;
+	fillInputCacheHeader(expectedHeader, inputHash);
+	if (cacheContents.size() < sizeof(expectedHeader) || memcmp(cacheContents.data(), &expectedHeader, sizeof(expectedHeader)) != 0)
+		return false;
+
+	/* Transfer into a scratch context so a truncated cache cannot leave this one half loaded */
+	SimContext *cached = new SimContext(*this);
+	InputCacheReader reader;
+	reader.pos = cacheContents.data() + sizeof(expectedHeader);
+	reader.end = cacheContents.data() + cacheContents.size();
+	cached->transferInputs(reader);
+	bool loaded = (reader.ok && reader.pos == reader.end);
+	if (loaded) {
+		*this = *cached;
+	}
+	delete cached;
+	return loaded;
+} /* end readInputsCache */
+
+/* writeInputsCache stores all the parsed inputs as a binary cache next to the input file; failure to write is not
+an error, the next run simply parses the text again */
+void SimContext::writeInputsCache(const string &cacheFileName, unsigned long long inputHash) {
+	InputCacheHeader header;
+	fillInputCacheHeader(header, inputHash);
+	InputCacheWriter writer;
+	writer.transfer(header);
+	transferInputs(writer);
+
+	FILE *cacheFile = CmvUtil::openFile(cacheFileName.c_str(), "wb");
+	if (cacheFile == NULL)
+		return;
+	size_t numWritten = fwrite(writer.buffer.data(), 1, writer.buffer.size(), cacheFile);
+	CmvUtil::closeFile(cacheFile);
+	if (numWritten != writer.buffer.size())
+		remove(cacheFileName.c_str());
+} /* end writeInputsCache */
+
+/* readAndSkipPast moves past the next occurrence of searchStr in the input file, looked up in the token index */
+bool SimContext::readAndSkipPast(const char* searchStr) {
+	if (inputTokens->skipPast(searchStr)) {
+		return true;
+	}
+	if(counter<=100){
+	printf("\nWARNING: label not found in the rest of the input file. Looking for %s \n",searchStr);
+	counter++;
+	}
+	return false;
 }  // readAndSkipPast
 
-bool SimContext::readAndSkipPast2( const char* searchStr1, const char* searchStr2, FILE* file ) {
-	bool ret = readAndSkipPast(searchStr1, file);
+bool SimContext::readAndSkipPast2( const char* searchStr1, const char* searchStr2 ) {
+	bool ret = readAndSkipPast(searchStr1);
 	if (ret == true)
-		ret = readAndSkipPast(searchStr2, file);
+		ret = readAndSkipPast(searchStr2);
 	return ret;
 }  // readAndSkipPast2
 
+/* Functions to read the value following the current position in the input file */
+bool SimContext::readInt(int &value) {
+	return inputTokens->readInt(value);
+}
+bool SimContext::readInt(bool &value) {
+	return inputTokens->readInt(value);
+}
+bool SimContext::readDouble(double &value) {
+	return inputTokens->readDouble(value);
+}
+bool SimContext::readString(string &value) {
+	return inputTokens->readString(value);
+}
+
+/* Parameter paths name an input as Section.field, e.g. PrenatalNatHist.weeklyPrimaryCMV, followed by one [index] per
+array dimension, e.g. PrenatalNatHist.primaryVerticalTransmission[2]. Prenatal tests and treatments are named
+PrenatalTest.<test name>.field (test names as in PRENATAL_TEST_NAMES) and PrenatalTreatment.Treatment<n>.field */
+#define VISIT_PARAMETER(prefix, object, field) visitor(string(prefix) + #field, (object).field)
+
+/* getExtents appends the size of each array dimension of T, outermost first */
+template <class T> static void getExtents(vector<int> &extents) {
+	if constexpr (std::rank<T>::value > 0) {
+		extents.push_back((int) std::extent<T>::value);
+		getExtents<typename std::remove_extent<T>::type>(extents);
+	}
+}
+
+/* ParameterSetter sets one element of the input whose name matches parameterName, used with SimContext::visitParameters */
+class ParameterSetter {
+public:
+	string parameterName;
+	vector<int> indices;
+	double value;
+	bool found = false;
+	string errorString;
+	template <class T> void operator()(const string &fieldName, T &field) {
+		if (found || fieldName != parameterName)
+			return;
+		found = true;
+		vector<int> extents;
+		getExtents<T>(extents);
+		if (indices.size() != extents.size()) {
+			errorString = "	ERROR - Parameter " + parameterName + " needs " + to_string(extents.size()) + " indices";
+			return;
+		}
+		size_t flatIndex = 0;
+		for (int i = 0; i < extents.size(); i++) {
+			if (indices[i] < 0 || indices[i] >= extents[i]) {
+				errorString = "	ERROR - Index out of range for parameter " + parameterName;
+				return;
+			}
+			flatIndex = flatIndex * extents[i] + indices[i];
+		}
+		typedef typename std::remove_all_extents<T>::type Element;
+		Element *elements = reinterpret_cast<Element *>(&field);
+		if constexpr (std::is_same<Element, bool>::value)
+			elements[flatIndex] = (value != 0);
+		else if constexpr (std::is_integral<Element>::value)
+			elements[flatIndex] = (Element) floor(value + 0.5);
+		else
+			elements[flatIndex] = (Element) value;
+	}
+};
+
+template <class Visitor> void SimContext::visitParameters(Visitor &visitor) {
+	int i;
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, numCohorts);
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, lastActiveCMVStrataBounds);
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, numberOfPatientsToTrace);
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, antitheticPairs);
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, infectionBiasFactor);
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, targetRelativeHalfWidth);
+	VISIT_PARAMETER("RunSpecs.", runSpecsInputs, convergenceCheckInterval);
+
+	VISIT_PARAMETER("Cohort.", cohortInputs, ageMonthsMean);
+	VISIT_PARAMETER("Cohort.", cohortInputs, ageMonthsStdDev);
+	VISIT_PARAMETER("Cohort.", cohortInputs, minimumAgeMonths);
+	VISIT_PARAMETER("Cohort.", cohortInputs, maximumAgeMonths);
+	VISIT_PARAMETER("Cohort.", cohortInputs, lastGotActiveCMVByStrata);
+	VISIT_PARAMETER("Cohort.", cohortInputs, weeklyProbBirth);
+	VISIT_PARAMETER("Cohort.", cohortInputs, CMVPositiveWeeklyProbBirth);
+	VISIT_PARAMETER("Cohort.", cohortInputs, probPrevCMVWasPrimary);
+	VISIT_PARAMETER("Cohort.", cohortInputs, oneTimeVerticalTransmissionProb);
+	VISIT_PARAMETER("Cohort.", cohortInputs, oneTimeVerticalTansmissionWeek);
+	VISIT_PARAMETER("Cohort.", cohortInputs, probSymptomsWithPrimaryCMV);
+	VISIT_PARAMETER("Cohort.", cohortInputs, probSymptomsWithSecondaryCMV);
+	VISIT_PARAMETER("Cohort.", cohortInputs, probPhenotypesUponVT);
+	VISIT_PARAMETER("Cohort.", cohortInputs, probMale);
+	VISIT_PARAMETER("Cohort.", cohortInputs, customAgeDistStrataProbs);
+	VISIT_PARAMETER("Cohort.", cohortInputs, lowAvidityDurationMean);
+	VISIT_PARAMETER("Cohort.", cohortInputs, lowAvidityDurationStdDev);
+
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeklyPrimaryCMV);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeklySecondaryCMV);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeklyProbMildIllness);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeklyProbKnownInfection);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToViremiaFromInfectionMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToViremiaFromInfectionStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, lengthOfViremiaMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, lengthOfViremiaStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToIgmPositiveFromInfectionMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToIgmPositiveFromInfectionStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, lengthOfIgmPositivityMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, lengthOfIgmPositivityStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToIggPositiveFromInfectionMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToIggPositiveFromInfectionStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToLowAvidityFromInfectionMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToLowAvidityFromInfectionStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToHighAvidityFromLowAvidityMean);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, weeksToHighAvidityFromLowAvidityStdDev);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, maternalInfectionToVerticalTransmissionDelay);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, verticalTransmissionToDetectableDelay);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, primaryVerticalTransmission);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, secondaryVerticalTransmission);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, backgroundMiscarriage);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, CMVPositiveMiscarriage);
+	VISIT_PARAMETER("PrenatalNatHist.", prenatalNatHistInputs, fetalDeathRiskDuringBirth);
+
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, seekingHealthcareSymptomatic);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, seekingHealthcareMildIllness);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, seekingHealthcareKnownInfection);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, weeksWithScheduledAppointments);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, probAttendingRegularAppointmentsByWeek);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, probReportingSymptoms);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, prematurityMultipliers);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, backgroundTesting);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, weeksWithVisitsUponMaternalDiagnosis);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, probAttendUponMaternalDiagnosis);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, testingUponMaternalDiagnosis);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, weeksWithVisitsUponChildDiagnosis);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, probAttendUponChildDiagnosis);
+	VISIT_PARAMETER("BackgroundScreening.", backgroundScreeningInputs, testingUponChildDiagnosis);
+
+	for (i = 0; i < prenatalTestingInputs.PrenatalTestsVector.size(); i++) {
+		PrenatalTestingInputs::PrenatalTest &test = prenatalTestingInputs.PrenatalTestsVector[i];
+		string prefix = string("PrenatalTest.") + PRENATAL_TEST_NAMES[i] + ".";
+		VISIT_PARAMETER(prefix, test, enableTest);
+		VISIT_PARAMETER(prefix, test, mildIllnessTrigger);
+		VISIT_PARAMETER(prefix, test, knownInfectionTrigger);
+		VISIT_PARAMETER(prefix, test, symptomaticCMVTrigger);
+		VISIT_PARAMETER(prefix, test, probOfferedAndAccept);
+		VISIT_PARAMETER(prefix, test, costOfTest);
+		VISIT_PARAMETER(prefix, test, probResultReturn);
+		VISIT_PARAMETER(prefix, test, weeksToResultReturn);
+		VISIT_PARAMETER(prefix, test, weeksToRepeatTestIfNoReturn);
+		VISIT_PARAMETER(prefix, test, minimumTestInterval);
+		VISIT_PARAMETER(prefix, test, probTerminationUponAbnormal);
+		VISIT_PARAMETER(prefix, test, availableStartingWeek);
+		VISIT_PARAMETER(prefix, test, notAvailableAfter);
+		VISIT_PARAMETER(prefix, test, testSensitivity);
+		VISIT_PARAMETER(prefix, test, testSpecificity);
+		VISIT_PARAMETER(prefix, test, numRepeatedConfirmatory);
+		VISIT_PARAMETER(prefix, test, probSchedulingConfirmatory);
+		VISIT_PARAMETER(prefix, test, weeksBetweenConfirmatoryTests);
+		VISIT_PARAMETER(prefix, test, additionalCostConfirmatoryTest);
+		VISIT_PARAMETER(prefix, test, followUpTests);
+		VISIT_PARAMETER(prefix, test, followUpTestsProbabilities);
+		VISIT_PARAMETER(prefix, test, followUpTestDelays);
+		VISIT_PARAMETER(prefix, test, FUTriggeredByTest);
+		VISIT_PARAMETER(prefix, test, FUTriggeredByTestProbabilities);
+		VISIT_PARAMETER(prefix, test, FUTriggeredByTestDelays);
+	}
+
+	VISIT_PARAMETER("PrenatalTreatment.", prenatalTreatmentInputs, treatmentBasedOnPolicy);
+	VISIT_PARAMETER("PrenatalTreatment.", prenatalTreatmentInputs, treatmentNumberBasedOnPolicy);
+	VISIT_PARAMETER("PrenatalTreatment.", prenatalTreatmentInputs, treatmentDurationBasedOnPolicy);
+	for (i = 0; i < prenatalTreatmentInputs.PrenatalTreatmentsVector.size(); i++) {
+		PrenatalTreatmentInputs::PrenatalTreatment &treatment = prenatalTreatmentInputs.PrenatalTreatmentsVector[i];
+		string prefix = "PrenatalTreatment.Treatment" + to_string(i + 1) + ".";
+		VISIT_PARAMETER(prefix, treatment, costPerWeek);
+		VISIT_PARAMETER(prefix, treatment, reductionOfWeeklyPrimaryCMV);
+		VISIT_PARAMETER(prefix, treatment, reductionOfWeeklyPrimaryProportionSymptomatic);
+		VISIT_PARAMETER(prefix, treatment, reductionOfWeeklySecondaryCMV);
+		VISIT_PARAMETER(prefix, treatment, reductionOfWeeklySecondaryProportionSymptomatic);
+		VISIT_PARAMETER(prefix, treatment, reductionOfPreviousVTFromPrimaryCMV);
+		VISIT_PARAMETER(prefix, treatment, reductionOfPreviousVTFromSecondaryCMV);
+		VISIT_PARAMETER(prefix, treatment, reductionOfVerticalTransmissionFromPrimaryCMV);
+		VISIT_PARAMETER(prefix, treatment, reductionOfVerticalTransmissionFromSecondaryCMV);
+		VISIT_PARAMETER(prefix, treatment, reductionOfSymptoms);
+	}
+} /* end visitParameters */
+
+/** \brief setParameter overrides one input, throws exception if the path does not name an input or an index is out of range
+ *
+ * Call rebuildDerivedInputs after the last override so the precomputed tables reflect the new values
+ *
+ * \param parameterPath the input to override, e.g. "PrenatalNatHist.primaryVerticalTransmission[2]"
+ * \param value the new value; rounded for integer inputs, nonzero is true for flags
+ */
+void SimContext::setParameter(const string &parameterPath, double value) {
+	ParameterSetter setter;
+	setter.value = value;
+	size_t bracket = parameterPath.find('[');
+	setter.parameterName = parameterPath.substr(0, bracket);
+	while (bracket != string::npos) {
+		size_t close = parameterPath.find(']', bracket);
+		if (close == string::npos) {
+			string errorString = "	ERROR - Unmatched [ in parameter " + parameterPath;
+			throw errorString;
+		}
+		setter.indices.push_back(atoi(parameterPath.substr(bracket + 1, close - bracket - 1).c_str()));
+		bracket = parameterPath.find('[', close);
+	}
+	visitParameters(setter);
+	if (!setter.found) {
+		string errorString = "	ERROR - Unknown parameter " + parameterPath;
+		throw errorString;
+	}
+	if (!setter.errorString.empty()) {
+		throw setter.errorString;
+	}
+} /* end setParameter */
+
+/** \brief rebuildDerivedInputs brings everything computed from the inputs up to date after setParameter: the named
+ * prenatal test and treatment objects are refreshed from the vectors that setParameter updates, and the sampling
+ * distributions and testing masks are rebuilt */
+void SimContext::rebuildDerivedInputs() {
+	vector<PrenatalTestingInputs::PrenatalTest> &tests = prenatalTestingInputs.PrenatalTestsVector;
+	if (tests.size() == NUM_PRENATAL_TESTS) {
+		prenatalTestingInputs.routineUltrasound = tests[ROUTINE_US];
+		prenatalTestingInputs.detailedUltrasound = tests[DETAILED_US];
+		prenatalTestingInputs.amniocentesis = tests[AMNIOCENTESIS];
+		prenatalTestingInputs.maternalPCR = tests[MATERNAL_PCR];
+		prenatalTestingInputs.igmTest = tests[IGM];
+		prenatalTestingInputs.iggTest = tests[IGG];
+		prenatalTestingInputs.avidityTest = tests[IGG_AVIDITY];
+	}
+	vector<PrenatalTreatmentInputs::PrenatalTreatment> &treatments = prenatalTreatmentInputs.PrenatalTreatmentsVector;
+	if (treatments.size() == NUM_TREATMENTS) {
+		prenatalTreatmentInputs.prenatalTreatment1 = treatments[TREATMENT_1];
+		prenatalTreatmentInputs.prenatalTreatment2 = treatments[TREATMENT_2];
+		prenatalTreatmentInputs.prenatalTreatment3 = treatments[TREATMENT_3];
+	}
+	buildDistributions();
+	buildTestingMasks();
+} /* end rebuildDerivedInputs */
+
+/** \brief setRunName renames the run, which names its output files and its row in the popstats file
+ * \param runName the new run name
+ */
+void SimContext::setRunName(const string &runName) {
+	runSpecsInputs.runName = runName;
+} /* end setRunName */
@@ -85,6 +85,7 @@ public:
         int weekToReturn;
         // Whether the result will be returned to the patient
         bool returnToPatient;
+        COUNT_COPIES_OF(PrenatalTestInstance)
     };
 
     /* Prenatal Test class that captures information about a particular prenatal test being administered */
@@ -143,6 +144,9 @@ public:
     static const int NUM_CUSTOM_AGE_STRATA = 30;
     /** Number of Prenatal Tests */
     static const int NUM_PRENATAL_TESTS = 7;
+    /** Set of prenatal tests, bit i standing for prenatal test i */
+    typedef unsigned char PrenatalTestMask;
+    static_assert(NUM_PRENATAL_TESTS <= 8 * sizeof(PrenatalTestMask), "PrenatalTestMask needs a bit per prenatal test");
     /** Number of indices for no none/true primary/true secondary infection */
     static const int NUM_INDX_TRUE_PRIMARY_SECONDARY_NONE = 3;
     /** Number of patients to be traced in the tracefile */
@@ -172,6 +176,15 @@ public:
         int lastActiveCMVStrataBounds[NUM_LAST_CMV_STRATA+1];
         /** RunSpecs K4 */
         int numberOfPatientsToTrace;
+        /** RunSpecs: simulate patients in antithetic pairs, the second of each pair drawing the mirror image (u -> 1-u) of the first one's random numbers */
+        bool antitheticPairs;
+        /** RunSpecs: odds ratio by which weekly maternal infection is oversampled, with likelihood-ratio weights keeping the weighted estimates unbiased; 1 disables it */
+        double infectionBiasFactor;
+        /** RunSpecs: relative half-width of the 95% confidence intervals of the key outcomes' means at which the cohort stops
+         * early, before numCohorts patients; 0 disables it */
+        double targetRelativeHalfWidth;
+        /** RunSpecs: number of patients simulated between checks of targetRelativeHalfWidth */
+        int convergenceCheckInterval;
         /** RunSpecs PUT LOC HERE */
         string userProgramLocale;
         /** RunSpecs PUT LOC HERE */
@@ -212,6 +225,10 @@ public:
         double probSymptomsWithSecondaryCMV[NUM_TRIMESTERS];
         /** CohortInputs D31:H32 -- probability of each CMV phenotype upon vertical transmission [PRIMARY/SECONDARY INFECTION][TRIMESTER][PHENOTYPE]*/
         double probPhenotypesUponVT[NUM_INDX_TRUE_PRIMARY_SECONDARY_NONE][NUM_TRIMESTERS][NUM_CMV_PHENOTYPES]; 
+        /** Precomputed distribution of lastGotActiveCMVByStrata */
+        DiscreteDist lastGotActiveCMVDist;
+        /** Precomputed distributions of probPhenotypesUponVT [PRIMARY/SECONDARY INFECTION][TRIMESTER] */
+        DiscreteDist phenotypesUponVTDist[NUM_INDX_TRUE_PRIMARY_SECONDARY_NONE][NUM_TRIMESTERS];
         /** CohortInputs probability male */
         double probMale;
         /** CohortInputs Enable Custom Age Distribution */
@@ -266,6 +283,8 @@ public:
         double backgroundMiscarriage[AGE_YEARS][MAX_WEEKS_PREGNANT];
         /** CMV Positive weekly probability of spontaneous abortion/miscarriage/IUFD/Stillbirth */
         double CMVPositiveMiscarriage[AGE_YEARS][MAX_WEEKS_PREGNANT];
+        /** Precomputed weekly distribution of miscarriage, birth, or continued pregnancy [AGE][WEEKS PREGNANT][CMV_NEGATIVE/CMV_POSITIVE] */
+        DiscreteDist pregnancyOutcomeDist[AGE_YEARS][MAX_WEEKS_PREGNANT][2];
 
         /** Probability of fetal death during birth */
         double fetalDeathRiskDuringBirth[MAX_WEEKS_PREGNANT][2];
@@ -322,6 +341,16 @@ public:
         //double probTestSuspectedChildCMV[NUM_PRENATAL_TESTS][2];
         /** Perform test every N visits, stratified by the week in which the visit occurs [WEEK][TEST NUM][ASYMPTOMATIC/SYMPTOMATIC]*/
         //bool weeksPerformTestsDiagnosedChildCMV[MAX_WEEKS_PREGNANT][NUM_PRENATAL_TESTS][2];
+
+        /* Test masks built by buildTestingMasks from the tables above and the prenatal test specs */
+        /** Tests available in each week, i.e. from their availableStartingWeek until before notAvailableAfter [WEEK] */
+        PrenatalTestMask availableTestsMask[MAX_WEEKS_PREGNANT];
+        /** backgroundTesting as masks [WEEK] */
+        PrenatalTestMask backgroundTestingMask[MAX_WEEKS_PREGNANT];
+        /** testingUponMaternalDiagnosis as masks [WEEK][NONE(0), PRIMARY(1), NONPRIMARY(2), RECENT UNKNOWN(3), NOT RECENT UNKNOWN (4)] */
+        PrenatalTestMask testingUponMaternalDiagnosisMask[MAX_WEEKS_PREGNANT][5];
+        /** testingUponChildDiagnosis as masks [WEEK][ASYMPTOMATIC/SYMPTOMATIC] */
+        PrenatalTestMask testingUponChildDiagnosisMask[MAX_WEEKS_PREGNANT][2];
     };
 
     class PrenatalTestingInputs {
@@ -378,6 +407,7 @@ public:
             double FUTriggeredByTestProbabilities[NUM_PRENATAL_TESTS][NUM_PRENATAL_TESTS][2];
              /** FUTriggeredByTestDelays array is stratified by [PRENATAL TEST THIS IS FOLLOWING UP FROM][FOLLOW UP TESTS TO THIS TEST][IS THIS TEST RESULT NORMAL OR ABNORMAL]*/
             int FUTriggeredByTestDelays[NUM_PRENATAL_TESTS][NUM_PRENATAL_TESTS][2];
+            COUNT_COPIES_OF(PrenatalTest)
         }; /* End prenatal test class */
 
         
@@ -418,6 +448,8 @@ public:
 
             /** Reduction of Symptomms */
             double reductionOfSymptoms[NUM_CMV_PHENOTYPES][NUM_CMV_PHENOTYPES];
+            /** Precomputed distributions of reductionOfSymptoms [PHENOTYPE] */
+            DiscreteDist reductionOfSymptomsDist[NUM_CMV_PHENOTYPES];
         };
 
         PrenatalTreatment prenatalTreatment1;
@@ -453,10 +485,16 @@ public:
     const InfantInputs *getInfantInputs();
     const AdultInputs *getAdultInputs();
 
+    /* Functions for overriding individual inputs in memory after they have been read, used by parameter sweeps.
+    setParameter throws exception if the parameter path is unknown or its indices are out of range */
+    void setParameter(const string &parameterPath, double value);
+    void rebuildDerivedInputs();
+    void setRunName(const string &runName);
+
 private:
-    /* Input file name and file pointer*/
+    /* Input file name and the tokenized input file, only set while the text inputs are being read */
     string inputFileName;
-    FILE *inputFile;
+    InputTokenizer *inputTokens;
 
     /* Objects for storing the input data */
     RunSpecsInputs runSpecsInputs;
@@ -479,8 +517,23 @@ private:
     void readPostPartumInputs();
     void readInfantInputs();
     void readAdultInputs();
-    bool readAndSkipPast(const char* searchStr, FILE* file);
-    bool readAndSkipPast2(const char* searchStr, const char* searchStr2, FILE* file);
+    bool readAndSkipPast(const char* searchStr);
+    bool readAndSkipPast2(const char* searchStr, const char* searchStr2);
+    bool readInt(int &value);
+    bool readInt(bool &value);
+    bool readDouble(double &value);
+    bool readString(string &value);
+    /* Builds the precomputed sampling distributions from the input tables, called by readInputs */
+    void buildDistributions();
+    /* Builds the weekly prenatal test masks from the screening tables and test specs, called by readInputs */
+    void buildTestingMasks();
+    /* Private Functions for the binary input cache, keyed by a hash of the .in file contents, called by readInputs */
+    bool readInputsCache(const string &cacheFileName, unsigned long long inputHash);
+    void writeInputsCache(const string &cacheFileName, unsigned long long inputHash);
+    template <class Archive> void transferInputs(Archive &archive);
+    template <class Archive> void transferPrenatalTest(Archive &archive, PrenatalTestingInputs::PrenatalTest &test);
+    /* Passes every input that can be overridden by parameter path to the visitor, called by setParameter */
+    template <class Visitor> void visitParameters(Visitor &visitor);
 
 };
 
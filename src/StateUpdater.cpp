@@ -76,6 +76,11 @@ void StateUpdater::setBreastFeeding(bool breastfeedingStatus) {
 
 void StateUpdater::incrementWeek() {
     patient->generalState.weekNum++;
+    // tests are never looked up for a week that has passed, so free up the schedule entries of the finished week
+    patient->generalState.pendingFollowUpTests.releaseWeeksBefore(patient->generalState.weekNum);
+    patient->generalState.pendingConfirmatoryTests.releaseWeeksBefore(patient->generalState.weekNum);
+    patient->generalState.specialCaseTests.releaseWeeksBefore(patient->generalState.weekNum);
+    patient->generalState.prenatalTestResultReturn.releaseWeeksBefore(patient->generalState.weekNum);
     patient->maternalState.maternalAgeYearsExact = patient->maternalState.maternalAgeYearsExact + (double)1/52;
     patient->maternalState.maternalAgeMonths = (int)(patient->maternalState.maternalAgeYearsExact/12 + 0.5);
     patient->maternalState.maternalAgeYears = (int)(patient->maternalState.maternalAgeYearsExact + 0.5);
@@ -111,20 +116,12 @@ void StateUpdater::setPrenatalTestsLastResult(int result, int testIndex) {
     patient->generalState.prenatalTestsLastResult[testIndex] = result;
 }
 
-void StateUpdater::setPendingFollowUpTestPerformed(bool performed, SimContext::PrenatalTestInstance followUpInstance) {
-    for (int i = 0; i < patient->generalState.pendingFollowUpTests[followUpInstance.weekToTest].size(); i++) {
-        if (followUpInstance.testID == patient->generalState.pendingFollowUpTests[followUpInstance.weekToTest][i].testID) {
-            patient->generalState.pendingFollowUpTests[followUpInstance.weekToTest][i].testPerformed = true;
-        }
-    }
+void StateUpdater::setPendingFollowUpTestPerformed(bool performed, const SimContext::PrenatalTestInstance &followUpInstance) {
+    patient->generalState.pendingFollowUpTests.markPerformed(followUpInstance.weekToTest, followUpInstance.testID);
 }
 
-void StateUpdater::setPendingConfirmatoryTestPerformed(bool performed, SimContext::PrenatalTestInstance confirmatoryInstance) {
-    for (int i = 0; i < patient->generalState.pendingConfirmatoryTests[confirmatoryInstance.weekToTest].size(); i++ ) {
-        if (confirmatoryInstance.testID == patient->generalState.pendingConfirmatoryTests[confirmatoryInstance.weekToTest][i].testID) {
-            patient->generalState.pendingConfirmatoryTests[confirmatoryInstance.weekToTest][i].testPerformed = true;
-        }
-    }
+void StateUpdater::setPendingConfirmatoryTestPerformed(bool performed, const SimContext::PrenatalTestInstance &confirmatoryInstance) {
+    patient->generalState.pendingConfirmatoryTests.markPerformed(confirmatoryInstance.weekToTest, confirmatoryInstance.testID);
 }
 
 void StateUpdater::setWeekTestLastPerformed(int week, int testIndex) {
@@ -135,14 +132,14 @@ void StateUpdater::setAppointmentThisWeek(bool prenatalAppointmentThisWeek) {
     patient->generalState.prenatalAppointmentThisWeek = prenatalAppointmentThisWeek;
 }
 
-void StateUpdater::setPrenatalTestResultReturn(int week, SimContext::PrenatalTestInstance prenatalTestInstance) {
+void StateUpdater::setPrenatalTestResultReturn(int week, const SimContext::PrenatalTestInstance &prenatalTestInstance) {
     int result = prenatalTestInstance.result;
     int testIndex = prenatalTestInstance.testAssay;
     if (result < -1 || result > 2) {
         std::cout << "INVALID RESULT, NOT A VALID OUTCOME. CHECK PRENATAL TEST SPECS. " << endl; cin.get();
     }
     else {
-        patient->generalState.prenatalTestResultReturn[week].push_back(prenatalTestInstance);
+        patient->generalState.prenatalTestResultReturn.push(prenatalTestInstance, week);
     }
 }
 
@@ -169,6 +166,29 @@ void StateUpdater::setHadTreatment(bool hadTreatment, int treatment) {
     patient->generalState.hadTreatment[treatment] = hadTreatment;
 }
 
+/** \brief rollMaternalInfection draws whether the mother gets infected this week
+ *
+ * With RunSpecs infectionBiasFactor f the draw uses the biased probability q whose odds are f times those of the true
+ * probability p, and the patient's importance weight is multiplied by the likelihood ratio of the outcome drawn, p/q
+ * if infected and (1-p)/(1-q) if not. Without a bias this is a plain draw against p.
+ *
+ * \param probMaternalCMV the true probability of infection this week
+*/
+bool StateUpdater::rollMaternalInfection(double probMaternalCMV) {
+    double randNum = getLeapRollRandomDouble(Patient::LEAP_ROLL_MATERNAL_INFECTION, CmvUtil::STREAM_MATERNAL_INFECTION);
+    double biasFactor = simContext->getRunSpecsInputs()->infectionBiasFactor;
+    if (biasFactor == 1 || biasFactor <= 0 || probMaternalCMV <= 0 || probMaternalCMV >= 1) {
+        return randNum < probMaternalCMV;
+    }
+    double biasedProb = biasFactor * probMaternalCMV / (1 + probMaternalCMV * (biasFactor - 1));
+    if (randNum < biasedProb) {
+        patient->generalState.importanceWeight *= probMaternalCMV / biasedProb;
+        return true;
+    }
+    patient->generalState.importanceWeight *= (1 - probMaternalCMV) / (1 - biasedProb);
+    return false;
+}
+
 /** Maternal Status updaters */
 void StateUpdater::setMaternalIsAlive(bool isAlive) {
     patient->maternalState.isAlive = isAlive;
@@ -214,6 +234,38 @@ void StateUpdater::setHadCMVDuringSim(bool hadCMVDuringSim) {
 }
 void StateUpdater::setWeekLastCMV(int weekLastCMV) {
     patient->maternalDiseaseState.weekLastCMV = weekLastCMV;
+    scheduleMaternalBiologyEvents();
+}
+
+/** \brief scheduleMaternalBiologyEvents clears the maternal biology timer wheel and schedules each transition of the
+ * infection in week weekLastCMV in the slot of the week it falls due. A later infection restarts the timeline, so the
+ * transitions of an earlier one are dropped. Transitions due before the current week, or a full turn of the wheel or
+ * more after it, are never reached by the pregnancy and are left off.
+*/
+void StateUpdater::scheduleMaternalBiologyEvents() {
+    Patient::MaternalDiseaseState *diseaseState = &patient->maternalDiseaseState;
+    memset(diseaseState->biologyEventWheel, 0, sizeof(diseaseState->biologyEventWheel));
+    int weeksAfterInfection[MaternalBiologyUpdater::NUM_BIOLOGY_EVENTS];
+    weeksAfterInfection[MaternalBiologyUpdater::EVENT_VIREMIA_START] = diseaseState->weeksToViremiaFromInfection;
+    weeksAfterInfection[MaternalBiologyUpdater::EVENT_IGM_POSITIVE] = diseaseState->weeksToIgmPositiveFromInfection;
+    weeksAfterInfection[MaternalBiologyUpdater::EVENT_IGG_POSITIVE] = diseaseState->weeksToIggPositiveFromInfection;
+    weeksAfterInfection[MaternalBiologyUpdater::EVENT_VIREMIA_END] = diseaseState->weeksToViremiaFromInfection + diseaseState->lengthOfViremia;
+    weeksAfterInfection[MaternalBiologyUpdater::EVENT_HIGH_AVIDITY] = diseaseState->weeksToLowAvidityFromInfection + diseaseState->weeksToHighAvidityFromLowAvidity;
+    weeksAfterInfection[MaternalBiologyUpdater::EVENT_IGM_NEGATIVE] = diseaseState->weeksToIgmPositiveFromInfection + diseaseState->lengthOfIgmPositivity;
+    int week = patient->generalState.weekNum;
+    for (int i = 0; i < MaternalBiologyUpdater::NUM_BIOLOGY_EVENTS; i++) {
+        int dueWeek = diseaseState->weekLastCMV + weeksAfterInfection[i];
+        if (dueWeek >= week && dueWeek < week + MaternalBiologyUpdater::BIOLOGY_WHEEL_SIZE) {
+            diseaseState->biologyEventWheel[dueWeek & (MaternalBiologyUpdater::BIOLOGY_WHEEL_SIZE - 1)] |= 1 << i;
+        }
+    }
+}
+
+unsigned char StateUpdater::popMaternalBiologyEvents() {
+    int slot = patient->generalState.weekNum & (MaternalBiologyUpdater::BIOLOGY_WHEEL_SIZE - 1);
+    unsigned char dueEvents = patient->maternalDiseaseState.biologyEventWheel[slot];
+    patient->maternalDiseaseState.biologyEventWheel[slot] = 0;
+    return dueEvents;
 }
 void StateUpdater::setMildIllness(bool mildIllness) {
     patient->maternalDiseaseState.mildIllness = mildIllness;
@@ -301,28 +353,20 @@ void StateUpdater::incrementNumUltrasounds() {
     patient->maternalMonitoringState.numUltrasounds++;
 }
 
-void StateUpdater::pushBackPrenatalFollowUp(SimContext::PrenatalTestInstance prenatalTestInstance) {
-    patient->generalState.pendingFollowUpTests[prenatalTestInstance.weekToTest].push_back(prenatalTestInstance);
+void StateUpdater::pushBackPrenatalFollowUp(const SimContext::PrenatalTestInstance &prenatalTestInstance) {
+    patient->generalState.pendingFollowUpTests.push(prenatalTestInstance, prenatalTestInstance.weekToTest);
 }
-void StateUpdater::pushBackPrenatalConfirmatory(SimContext::PrenatalTestInstance prenatalTestInstance) {
-    patient->generalState.pendingConfirmatoryTests[prenatalTestInstance.weekToTest].push_back(prenatalTestInstance);
+void StateUpdater::pushBackPrenatalConfirmatory(const SimContext::PrenatalTestInstance &prenatalTestInstance) {
+    patient->generalState.pendingConfirmatoryTests.push(prenatalTestInstance, prenatalTestInstance.weekToTest);
 }
-void StateUpdater::pushBackPrenatalSpecialCase(SimContext::PrenatalTestInstance prenatalTestInstance) {
-    patient->generalState.specialCaseTests[prenatalTestInstance.weekToTest].push_back(prenatalTestInstance);
+void StateUpdater::pushBackPrenatalSpecialCase(const SimContext::PrenatalTestInstance &prenatalTestInstance) {
+    patient->generalState.specialCaseTests.push(prenatalTestInstance, prenatalTestInstance.weekToTest);
 }
 void StateUpdater::markPendingFollowUpTestAsDone(int testID) {
-    for (int i = 0; i < patient->generalState.pendingFollowUpTests[patient->generalState.weekNum].size(); i++) {
-        if (patient->generalState.pendingFollowUpTests[patient->generalState.weekNum][i].testID == testID) {
-            patient->generalState.pendingFollowUpTests[patient->generalState.weekNum][i].testPerformed = true;
-        }
-    }
+    patient->generalState.pendingFollowUpTests.markPerformed(patient->generalState.weekNum, testID);
 }
 void StateUpdater::markPendingConfirmatoryTestAsDone(int testID) {
-    for (int i = 0; i < patient->generalState.pendingConfirmatoryTests[patient->generalState.weekNum].size(); i++) {
-        if (patient->generalState.pendingConfirmatoryTests[patient->generalState.weekNum][i].testID == testID) {
-            patient->generalState.pendingConfirmatoryTests[patient->generalState.weekNum][i].testPerformed = true;
-        }
-    }
+    patient->generalState.pendingConfirmatoryTests.markPerformed(patient->generalState.weekNum, testID);
 }
 
 void StateUpdater::setSuspectedCMVStatus(int suspectedCMVStatus) {
@@ -410,13 +454,9 @@ void StateUpdater::symptomReductionAlgorithm() {
         int mostRecentTreatmentNumber = patient->getGeneralState()->mostRecentTreatmentNumber;
         // phenotype cannot be reduced if it's already at phenotype 0
         if (phenotype > 0) {
-            vector<double> switchingProbabilityVector(0,SimContext::NUM_CMV_PHENOTYPES);
-            for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
-                switchingProbabilityVector.push_back(simContext->getPrenatalTreatmentInputs()->PrenatalTreatmentsVector[mostRecentTreatmentNumber].reductionOfSymptoms[phenotype][i]);
-            }
-            
-            double randNum = CmvUtil::getRandomDouble();
-            int updatedPhenotype = CmvUtil::selectFromDist(switchingProbabilityVector, randNum);
+            const DiscreteDist &switchingProbabilityDist = simContext->getPrenatalTreatmentInputs()->PrenatalTreatmentsVector[mostRecentTreatmentNumber].reductionOfSymptomsDist[phenotype];
+            double randNum = CmvUtil::getRandomDouble(CmvUtil::STREAM_TREATMENT_EFFECT);
+            int updatedPhenotype = switchingProbabilityDist.sample(randNum);
             setPhenotypeCMV(updatedPhenotype);
             if (patient->getGeneralState()->tracingEnabled) {
                 tracer->printTrace(1, "Phenotype changed from Type %d to Type %d due to Treatment %d\n", phenotype, updatedPhenotype, mostRecentTreatmentNumber+1);
@@ -517,6 +557,48 @@ void StateUpdater::incrementNumCMVPositiveChildrenBornNeverTreatment() {
     runStats->popSummary.numCMVPositiveChildrenBornNeverTreatment++;
 }
 
+void StateUpdater::addPairedOutcomes(bool hadTreatment) {
+    double outcomes[RunStats::NUM_PAIRED_OUTCOMES];
+    outcomes[RunStats::PAIRED_MATERNAL_CMV] = patient->getMaternalDiseaseState()->hadCMVDuringSim ? 1 : 0;
+    outcomes[RunStats::PAIRED_FETAL_CMV] = patient->getChildDiseaseState()->hadCMV ? 1 : 0;
+    outcomes[RunStats::PAIRED_LIVE_BIRTH] = (patient->getChildState()->deliveryOcurred && patient->getChildState()->isAlive) ? 1 : 0;
+    outcomes[RunStats::PAIRED_FETAL_DEATH] = patient->getChildState()->isAlive ? 0 : 1;
+    outcomes[RunStats::PAIRED_MATERNAL_DIAGNOSED] = patient->getMaternalMonitoringState()->diagnosedCMV ? 1 : 0;
+    outcomes[RunStats::PAIRED_ANY_TREATMENT] = hadTreatment ? 1 : 0;
+    runStats->addPairedOutcomes(patient->getGeneralState()->patientNum, outcomes);
+}
+
+double StateUpdater::getLeapRollRandomDouble(int leapRoll, int streamId) {
+    double randNum = patient->presetRolls[leapRoll];
+    if (randNum < 0) {
+        return CmvUtil::getRandomDouble(streamId);
+    }
+    patient->presetRolls[leapRoll] = -1;
+    return randNum;
+}
+
+void StateUpdater::addWeightedOutcomes() {
+    bool hadCMV = patient->getChildDiseaseState()->hadCMV;
+    bool liveBirth = patient->getChildState()->deliveryOcurred && patient->getChildState()->isAlive;
+    bool outcomes[RunStats::NUM_WEIGHTED_OUTCOMES];
+    outcomes[RunStats::WEIGHTED_MATERNAL_CMV] = patient->getMaternalDiseaseState()->hadCMVDuringSim;
+    outcomes[RunStats::WEIGHTED_VERTICAL_TRANSMISSION] = patient->getMaternalDiseaseState()->verticalTransmission;
+    outcomes[RunStats::WEIGHTED_CMV_BIRTH] = hadCMV && liveBirth;
+    outcomes[RunStats::WEIGHTED_CMV_FETAL_DEATH] = hadCMV && !patient->getChildState()->isAlive;
+    for (int i = 0; i < SimContext::NUM_CMV_PHENOTYPES; i++) {
+        outcomes[RunStats::WEIGHTED_CMV_BIRTH_BY_TYPE + i] = hadCMV && liveBirth && patient->getChildDiseaseState()->phenotypeCMV == i;
+    }
+    runStats->addWeightedOutcomes(patient->getGeneralState()->importanceWeight, outcomes);
+}
+
+void StateUpdater::addPrecisionOutcomes() {
+    int outcomes[RunStats::NUM_PRECISION_OUTCOMES];
+    outcomes[RunStats::PRECISION_MATERNAL_CMV] = patient->getMaternalDiseaseState()->hadCMVDuringSim ? 1 : 0;
+    outcomes[RunStats::PRECISION_CONGENITAL_CMV] = patient->getChildDiseaseState()->hadCMV ? 1 : 0;
+    outcomes[RunStats::PRECISION_TESTS_PER_PREGNANCY] = patient->getGeneralState()->numPrenatalTestsPerformed;
+    runStats->addPrecisionOutcomes(patient->getGeneralState()->importanceWeight, outcomes);
+}
+
 void StateUpdater::incrementNumCurrOnTreatment(int treatment) {
     runStats->popSummary.totalWeeksOnEachTreatment[treatment]++;
     RunStats::PrenatalTimeSummary *currTime = getPrenatalTimeSummaryForUpdate();
@@ -646,6 +728,7 @@ void StateUpdater::incrementMaternalCMVNoFetalCMV() {
 }
 
 void StateUpdater::incrementNumTestPerformed(int testNum) {
+    patient->generalState.numPrenatalTestsPerformed++;
     runStats->popSummary.totalNumPrenatalTest[testNum]++;
     RunStats::PrenatalTimeSummary *currTime = getPrenatalTimeSummaryForUpdate();
     if (currTime) {
@@ -984,18 +1067,15 @@ void StateUpdater::incrementNumFetalDeathsAtBirth() {
 
 
 
-/** \brief getPrenatalTimeSummaryForUpdate returns a non-const pointer to the PrenatalTimeSummary object for the current time period.*/
+/** \brief getPrenatalTimeSummaryForUpdate returns a non-const pointer to the PrenatalTimeSummary object for the current time period,
+ * marking the week as reached; returns null past the last week of pregnancy.*/
 RunStats::PrenatalTimeSummary *StateUpdater::getPrenatalTimeSummaryForUpdate() {
-    int timePeriod;
-    timePeriod = patient->generalState.weekNum;
-    if (timePeriod < (int) runStats->prenatalTimeSummaries.size()) {
-        return runStats->prenatalTimeSummaries[timePeriod];
-    }
-    for (int i = (int) runStats->prenatalTimeSummaries.size(); i <= timePeriod; i++) {
-        RunStats::PrenatalTimeSummary *currTime = new RunStats::PrenatalTimeSummary();
-        runStats->initPrenatalTimeSummary(currTime);
-        currTime->timePeriod = i;
-        runStats->prenatalTimeSummaries.push_back(currTime);
-    }
-    return runStats->prenatalTimeSummaries[timePeriod];
+    int timePeriod = patient->generalState.weekNum;
+    if (timePeriod >= SimContext::MAX_WEEKS_PREGNANT) {
+        return NULL;
+    }
+    if (timePeriod >= runStats->numPrenatalTimeSummaries) {
+        runStats->numPrenatalTimeSummaries = timePeriod + 1;
+    }
+    return &runStats->prenatalTimeSummaries[timePeriod];
 } /* end getPrenatalTimeSummaryForUpdate */
\ No newline at end of file
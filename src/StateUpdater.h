@@ -81,16 +81,16 @@ protected:
 	/* Sets last prenatal test result */
 	void setPrenatalTestsLastResult(int result, int testIndex);
 	/* Sets testResult of a Prenatal Test Instance to "true" in the Pending Follow Up Tests patient array */
-	void setPendingFollowUpTestPerformed(bool performed, SimContext::PrenatalTestInstance followUpInstance);
+	void setPendingFollowUpTestPerformed(bool performed, const SimContext::PrenatalTestInstance &followUpInstance);
 	/* Sets testResult of a Prenatal Test Instance to "true" in the Pending Confirmatory Tests patient array */
-	void setPendingConfirmatoryTestPerformed(bool performed, SimContext::PrenatalTestInstance confirmatoryInstance);
+	void setPendingConfirmatoryTestPerformed(bool performed, const SimContext::PrenatalTestInstance &confirmatoryInstance);
 	/* Sets the week that a prenatal test was last performed in the weekTestLastPerformed array (week, testIndex)*/
 	void setWeekTestLastPerformed(int week, int testIndex);
 	/* For a given week, sets its test performed value to true for the patient */
 	void setAppointmentThisWeek(bool prenatalAppointmentThisWeek);
 	/* For a given week, sets its appointment-triggered-by-symptoms to true for the patient */
 	/* Sets the week of result return, the test that was performed, and the result of the test (0 for negative/none, 1 for positive/low, 2 for high - only for Avidity) */
-	void setPrenatalTestResultReturn(int week, SimContext::PrenatalTestInstance prenatalTestInstance);
+	void setPrenatalTestResultReturn(int week, const SimContext::PrenatalTestInstance &prenatalTestInstance);
 	/** Sets whether the patient mother child pair is on treatment */
 	void setOnTreatment(bool onTreatment);
 	/** Sets the treatment number that the patient mother child pair is on */
@@ -99,6 +99,10 @@ protected:
 	void setWeekTreatmentStarted(int week, int treatment);
 	/** Sets whether patient has had treatment */
 	void setHadTreatment(bool hadTreatment, int treatment);
+	/** Rolls for this week's maternal infection, oversampled and weighted when RunSpecs infectionBiasFactor is set */
+	bool rollMaternalInfection(double probMaternalCMV);
+	/** Returns the random number preset by Patient::leapQuietWeeks for one of the rolls it conditions, or a new draw if none is preset */
+	double getLeapRollRandomDouble(int leapRoll, int streamId);
 
 
 	/* setMaternalAliveStatus sets the life status of the mother */
@@ -118,8 +122,12 @@ protected:
 	void setHadCMV(bool hadCMV);
 	/* setHadCMVDuringSim sets whether mother has had CMV during the simulation (since the beginning of simulation, not before )*/
 	void setHadCMVDuringSim(bool hadCMVDuringSim);
-	/* setWeekLastCMV sets the last month that the patient had Active CMV */
+	/* setWeekLastCMV sets the last month that the patient had Active CMV and schedules the maternal biology transitions of that infection */
 	void setWeekLastCMV(int weekLastCMV);
+	/* scheduleMaternalBiologyEvents replaces the timer wheel's transitions with those of the infection in week weekLastCMV */
+	void scheduleMaternalBiologyEvents();
+	/* popMaternalBiologyEvents returns the transitions due this week and clears them from the timer wheel */
+	unsigned char popMaternalBiologyEvents();
 	/* setActiveCMV sets whether patient has active cmv */
 	void setActiveCMV(bool activeCMV);
 	/* setViremia sets whether patient has CMV viremia */
@@ -189,11 +197,11 @@ protected:
 	/* setNumMissedAppointments sets the number of ultrasounds for the mother */
 	void setNumUltrasounds(int numUltrasounds);
 	/* push back Prenatal Follow Up Test to patient's follow up test vector*/
-	void pushBackPrenatalFollowUp(SimContext::PrenatalTestInstance prenatalTestInstance);
+	void pushBackPrenatalFollowUp(const SimContext::PrenatalTestInstance &prenatalTestInstance);
 	/* push back Prenatal Confirmatory Test to patient's confirmatory test vector */
-	void pushBackPrenatalConfirmatory(SimContext::PrenatalTestInstance prenatalTestInstance);
+	void pushBackPrenatalConfirmatory(const SimContext::PrenatalTestInstance &prenatalTestInstance);
 	/* push back Prenatal Special Case Test to patient's special case test vector */
-	void pushBackPrenatalSpecialCase(SimContext::PrenatalTestInstance prenatalTestInstance);
+	void pushBackPrenatalSpecialCase(const SimContext::PrenatalTestInstance &prenatalTestInstance);
 	/* deleteFromPendingFollowUps*/
 	void markPendingFollowUpTestAsDone(int testID);
 	/* deleteFromPendingConfirmatory */
@@ -279,6 +287,12 @@ protected:
 	void incrementNumCMVPositiveChildrenBornWithTreatment();
 	/** Increment number of cCMV positive children who were born to mothers who were NEVER on treatment */
 	void incrementNumCMVPositiveChildrenBornNeverTreatment();
+	/** Add the patient's outcomes to the antithetic pair sums */
+	void addPairedOutcomes(bool hadTreatment);
+	/** Add the patient's outcomes, weighted by its importance weight, to the weighted summary */
+	void addWeightedOutcomes();
+	/** Add the patient's outcomes to the running sums behind the confidence intervals of the key outcomes */
+	void addPrecisionOutcomes();
 	void incrementNumCurrOnTreatment(int treatment);
 	void incrementNumCMVMothersOnTreatment(int treatment);
 	void incrementCMVFetusesOnTreatment(int treatment);
@@ -357,8 +371,8 @@ protected:
 	void incrementNumFetalDeathsAtBirth();
 
 private:
-	/* getPrenatalTimeSummary returns a non-const pointer to the PrenatalTimeSummary object for the current time period, 
-	creates a new one if needed. */
+	/* getPrenatalTimeSummary returns a non-const pointer to the PrenatalTimeSummary object for the current time period,
+	null past the last week of pregnancy. */
 	RunStats::PrenatalTimeSummary *getPrenatalTimeSummaryForUpdate();
 
 };
@@ -37,6 +37,7 @@ void SummaryStats::addRunStats(RunStats *runStats) {
     summary->averageWeekBirthNoCMV = (float)childSummary->averageWeekBirthNoCMV;
     summary->averageWeekBirthWithCMV = (float)childSummary->averageWeekBirthCMV;
     summary->proportionChildCMV = (float)childSummary->numCMVInfections/popSummary->numCohorts;
+    summary->infectionBiasFactor = popSummary->infectionBiasFactor;
         
 
     /** Add the new summary to the appropriate vector, create a new vector if this
@@ -115,7 +116,11 @@ void SummaryStats::writeSummariesFile() {
        
             
             fprintf(summariesFile, "%lf\t", summary->proportionChildCMV);
-            
+
+            /** Flagging rows whose proportions are biased by oversampling; the weighted estimates are only in the .out file */
+            if (summary->infectionBiasFactor != 1) {
+                fprintf(summariesFile, "OVERSAMPLED, UNWEIGHTED (Infection Bias Factor %lf)\t", summary->infectionBiasFactor);
+            }
         }
     }
 }
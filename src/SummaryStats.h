@@ -37,6 +37,8 @@ public:
         double averageWeekBirthWithCMV;
         /** Proportion of children that had CMV Infection */
         double proportionChildCMV;
+        /** RunSpecs infectionBiasFactor of the run; when not 1 the proportions are of the oversampled cohort, unweighted */
+        double infectionBiasFactor;
     };
 
     /* addRunStats adds a new summary to the vector from a RunStats object */
@@ -0,0 +1,166 @@
+#include "include.h"
+
+/** \brief Constructor takes in the name of the .sweep file
+ * \param sweepFileName the name of the sweep file in the inputs directory; the sweep name is this without its extension
+*/
+SweepSpec::SweepSpec(string sweepFileName) {
+    this->sweepFileName = sweepFileName;
+    sweepName = sweepFileName.substr(0, sweepFileName.find(CmvUtil::FILE_EXTENSION_FOR_SWEEP));
+} /* end Constructor */
+
+/** \brief Destructor is empty, no cleanup required */
+SweepSpec::~SweepSpec(void) {
+
+} /* end Destructor */
+
+/** \brief readSpec reads the base input file name and the swept parameters from the sweep file, throws exception if
+ * the file cannot be opened, has an unknown entry, or does not name a base input and at least one value per parameter
+*/
+void SweepSpec::readSpec() {
+    CmvUtil::changeDirectoryToInputs();
+    ifstream sweepFile(sweepFileName.c_str());
+    if (!sweepFile.is_open()) {
+        string errorString = "	ERROR - Could not open sweep file ";
+        errorString.append(sweepFileName);
+        throw errorString;
+    }
+
+    string line;
+    while (getline(sweepFile, line)) {
+        line = line.substr(0, line.find('#'));
+        istringstream lineStream(line);
+        string entry;
+        if (!(lineStream >> entry)) {
+            continue;
+        }
+        if (entry == "BaseInput") {
+            lineStream >> baseInputName;
+        }
+        else if (entry == "Parameter") {
+            SweepParameter parameter;
+            lineStream >> parameter.parameterPath;
+            double value;
+            while (lineStream >> value) {
+                parameter.values.push_back(value);
+            }
+            if (parameter.values.empty() || !lineStream.eof()) {
+                string errorString = "	ERROR - Sweep parameter needs a list of numeric values: ";
+                errorString.append(line);
+                throw errorString;
+            }
+            parameters.push_back(parameter);
+        }
+        else {
+            string errorString = "	ERROR - Unknown entry in sweep file ";
+            errorString.append(sweepFileName + ": " + entry);
+            throw errorString;
+        }
+    }
+    if (baseInputName.empty() || parameters.empty()) {
+        string errorString = "	ERROR - Sweep file needs a BaseInput and at least one Parameter: ";
+        errorString.append(sweepFileName);
+        throw errorString;
+    }
+} /* end readSpec */
+
+/** \brief validateSpec applies every value of every parameter to a scratch copy of the base inputs, so that a bad
+ * path or index is reported before any variant is run; throws exception on the first error. Oversampled maternal
+ * infection is rejected, since the variants file reports only the unweighted proportions.
+ * \param baseContext a pointer to the SimContext holding the parsed base inputs, not modified
+*/
+void SweepSpec::validateSpec(SimContext *baseContext) {
+    bool isOversampled = baseContext->getRunSpecsInputs()->infectionBiasFactor != 1;
+    for (int i = 0; i < parameters.size(); i++) {
+        isOversampled = isOversampled || parameters[i].parameterPath == "RunSpecs.infectionBiasFactor";
+    }
+    if (isOversampled) {
+        string errorString = "	ERROR - Sweeps cannot oversample maternal infection, the variants would report biased proportions; set InfectionBiasFactor to 1: ";
+        errorString.append(sweepFileName);
+        throw errorString;
+    }
+    SimContext *scratchContext = new SimContext(*baseContext);
+    try {
+        for (int i = 0; i < parameters.size(); i++) {
+            for (int j = 0; j < parameters[i].values.size(); j++) {
+                scratchContext->setParameter(parameters[i].parameterPath, parameters[i].values[j]);
+            }
+        }
+    }
+    catch (string &errorString) {
+        delete scratchContext;
+        throw;
+    }
+    delete scratchContext;
+} /* end validateSpec */
+
+/** \brief getBaseRunName returns the run name of the base input: its file name without the .in extension */
+string SweepSpec::getBaseRunName() {
+    return baseInputName.substr(0, baseInputName.find(CmvUtil::FILE_EXTENSION_FOR_INPUT));
+} /* end getBaseRunName */
+
+/** \brief getNumVariants returns the number of combinations of parameter values */
+int SweepSpec::getNumVariants() {
+    int numVariants = 1;
+    for (int i = 0; i < parameters.size(); i++) {
+        numVariants *= parameters[i].values.size();
+    }
+    return numVariants;
+} /* end getNumVariants */
+
+/** \brief getValueIndex returns which of a parameter's values the given variant uses, counting with the last parameter fastest
+ * \param variantNum the number of the variant, from 0 to getNumVariants() - 1
+ * \param paramNum the index of the parameter in the sweep file
+*/
+int SweepSpec::getValueIndex(int variantNum, int paramNum) {
+    for (int i = parameters.size() - 1; i > paramNum; i--) {
+        variantNum /= parameters[i].values.size();
+    }
+    return variantNum % parameters[paramNum].values.size();
+} /* end getValueIndex */
+
+/** \brief getVariantRunName returns the run name of a variant: the sweep name followed by the variant number
+ * \param variantNum the number of the variant, from 0 to getNumVariants() - 1
+*/
+string SweepSpec::getVariantRunName(int variantNum) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "_%04d", variantNum + 1);
+    return sweepName + buffer;
+} /* end getVariantRunName */
+
+/** \brief applyVariant sets the variant's run name and parameter values on a copy of the base SimContext, throws exception if a parameter cannot be set
+ * \param simContext a pointer to the SimContext to modify, a copy of the parsed base inputs
+ * \param variantNum the number of the variant, from 0 to getNumVariants() - 1
+*/
+void SweepSpec::applyVariant(SimContext *simContext, int variantNum) {
+    simContext->setRunName(getVariantRunName(variantNum));
+    for (int i = 0; i < parameters.size(); i++) {
+        simContext->setParameter(parameters[i].parameterPath, parameters[i].values[getValueIndex(variantNum, i)]);
+    }
+    simContext->rebuildDerivedInputs();
+} /* end applyVariant */
+
+/** \brief writeVariantsFile writes a tab separated table of each variant's run name and parameter values to the results directory */
+void SweepSpec::writeVariantsFile() {
+    CmvUtil::changeDirectoryToResults();
+    string variantsFileName = sweepName;
+    variantsFileName.append(CmvUtil::FILE_NAME_SUFFIX_SWEEP_VARIANTS);
+    FILE *variantsFile = CmvUtil::openFile(variantsFileName.c_str(), "w");
+    if (variantsFile == NULL) {
+        string errorString = "	ERROR - Could not write sweep variants file ";
+        errorString.append(variantsFileName);
+        throw errorString;
+    }
+    fprintf(variantsFile, "Run Name\tBase Input");
+    for (int i = 0; i < parameters.size(); i++) {
+        fprintf(variantsFile, "\t%s", parameters[i].parameterPath.c_str());
+    }
+    fprintf(variantsFile, "\n");
+    for (int variantNum = 0; variantNum < getNumVariants(); variantNum++) {
+        fprintf(variantsFile, "%s\t%s", getVariantRunName(variantNum).c_str(), baseInputName.c_str());
+        for (int i = 0; i < parameters.size(); i++) {
+            fprintf(variantsFile, "\t%g", parameters[i].values[getValueIndex(variantNum, i)]);
+        }
+        fprintf(variantsFile, "\n");
+    }
+    CmvUtil::closeFile(variantsFile);
+} /* end writeVariantsFile */
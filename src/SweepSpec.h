@@ -0,0 +1,55 @@
+#pragma once
+
+#include "include.h"
+
+/**
+ * The SweepSpec class reads a parameter sweep specification (.sweep file) and describes its variants. A sweep names a
+ * base .in file and a grid of values for one or more inputs; main parses the base once and runs one copy of its
+ * SimContext per combination of values, each with the overrides applied in memory.
+ *
+ * Sweep file format, one entry per line, with # starting a comment:
+ *   BaseInput <file name of the base .in file, in the inputs directory>
+ *   Parameter <parameter path, see SimContext::setParameter> <value> [<value> ...]
+*/
+class SweepSpec
+{
+public:
+    /* Constructor takes in the name of the .sweep file */
+    SweepSpec(string sweepFileName);
+    ~SweepSpec(void);
+
+    /* readSpec reads the sweep file, throws exception if there is an error */
+    void readSpec();
+    /* validateSpec checks every parameter path and value against the base inputs, throws exception if there is an error */
+    void validateSpec(SimContext *baseContext);
+
+    /* Functions for accessing and applying the variants; the last parameter varies fastest */
+    string getBaseRunName();
+    int getNumVariants();
+    string getVariantRunName(int variantNum);
+    void applyVariant(SimContext *simContext, int variantNum);
+    /* writeVariantsFile writes the table of parameter values for each variant to the results directory */
+    void writeVariantsFile();
+
+private:
+    /** SweepParameter stores one swept input and its grid of values */
+    class SweepParameter {
+    public:
+        /** The path of the input, e.g. PrenatalNatHist.weeklyPrimaryCMV */
+        string parameterPath;
+        /** The values to run */
+        vector<double> values;
+    };
+
+    /** The name of the .sweep file */
+    string sweepFileName;
+    /** The sweep name: the .sweep file name without its extension, prefixed to every variant run name */
+    string sweepName;
+    /** The file name of the base .in file */
+    string baseInputName;
+    /** The swept inputs */
+    vector<SweepParameter> parameters;
+
+    /* getValueIndex returns which of a parameter's values the given variant uses */
+    int getValueIndex(int variantNum, int paramNum);
+};
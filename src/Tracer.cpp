@@ -12,6 +12,7 @@ Tracer::Tracer(string runName, SimContext *simContext, int traceLevel) {
     
     this->traceLevel = traceLevel;
     this->simContext = simContext;
+    traceFile = NULL;
 } /* end Constructor*/
 
 /** \brief Destructor is empty, no cleanup required */
@@ -43,9 +44,8 @@ void Tracer::printTraceHeader() {
 }
 
 void Tracer::printTrace(int level, const char *format, ...) {
-    // return if trace file is not valid
+    // return if trace file is not open; a Tracer that is never opened (e.g. for a PSA draw) discards its output
     if (traceFile == NULL) {
-        std::cout << "INVALID TRACE FILE ADDRESS";
         return;
     }
     if (level > traceLevel) {
@@ -18,11 +18,19 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <string_view>
 #include <algorithm>
 #include <list>
 #include <fstream>
+#include <sstream>
 #include <typeinfo>
 #include <numeric>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
 
 using namespace std;
 
@@ -33,12 +41,21 @@ class RunStats;
 class CostStats;
 class SummaryStats;
 class Patient;
+class InputTokenizer;
+class PhiloxRand;
 
+#include "DiscreteDist.h"
+#include "FixedPointSum.h"
+#include "CopyCounter.h"
+#include "InputTokenizer.h"
 #include "SimContext.h"
+#include "PrenatalTestSchedule.h"
 #include "Tracer.h"
 #include "RunStats.h"
 #include "CostStats.h"
 #include "SummaryStats.h"
+#include "SweepSpec.h"
+#include "PsaSpec.h"
 #include "StateUpdater.h"
 #include "BeginWeekUpdater.h"
 #include "EndWeekUpdater.h"
@@ -49,8 +66,9 @@ class Patient;
 #include "PregnancyUpdater.h"
 #include "Patient.h"
 
-#include "mtrand.h"
+#include "philox.h"
 #include "CmvUtil.h"
+#include "BatchEngine.h"
 
 
 
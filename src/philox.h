@@ -0,0 +1,158 @@
+/** \file philox.h
+// C++ include file for a Philox4x32-10 counter-based random number generator.
+// Algorithm from J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+// "Parallel Random Numbers: As Easy as 1, 2, 3", SC11 (2011).
+//
+// A counter-based generator has no evolving state: the n-th number of a stream
+// is a pure function of (key, n). The key is the run seed and patient number,
+// and the counter holds a stream id and a block index, so every patient (and
+// every stream within a patient) can be reproduced in isolation, in any order,
+// on any thread. */
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <stdint.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/** Philox4x32-10 counter-based random number generator */
+class PhiloxRand {
+public:
+/** default constructor: run seed 0, patient 0, stream 0 */
+  PhiloxRand() : mirrored(0) { seed(0, 0); }
+/** constructor keyed by run seed and patient number */
+  PhiloxRand(uint32_t runSeed, uint32_t patientNum) : mirrored(0) { seed(runSeed, patientNum); }
+/** key the generator by run seed and patient number and restart at stream 0 */
+  void seed(uint32_t runSeed, uint32_t patientNum) { key[0] = runSeed; key[1] = patientNum; setStream(0); }
+/** select a stream within the current key and restart its counter */
+  void setStream(uint32_t streamId) { stream = streamId; blockNum = 0; pos = 4; }
+/** return the id of the current stream */
+  uint32_t getStream() const { return stream; }
+/** mirror every output x to 2^32 - 1 - x, so uniforms u become 1 - u - 2^-32 (antithetic variates); kept across seed() */
+  void setMirrored(bool mirror) { mirrored = mirror ? 0xFFFFFFFFu : 0u; }
+/** return whether the outputs are mirrored */
+  bool isMirrored() const { return mirrored != 0; }
+/** generate a 32 bit random integer */
+  uint32_t randInt32() { if (pos == 4) { gen_block(); pos = 0; } return block[pos++] ^ mirrored; }
+/** overload operator() to make this a generator (functor): random number in [0, 1), same resolution as MTRand */
+  double operator()() { return randInt32() * (1. / 4294967296.); } // divided by 2^32
+/** fill uniforms[0..n) with the next n numbers of operator(), generating whole blocks several counters at a time */
+  void fillUniforms(double *uniforms, int n);
+/** number of blocks gen_blocks encrypts together, one per SIMD lane */
+  static const int BLOCKS_PER_BATCH = 8;
+private:
+  static const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57; // round multipliers
+  static const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85; // Weyl key increments
+  uint32_t key[2]; // run seed, patient number
+  uint32_t stream; // stream id, third word of the counter
+  uint64_t blockNum; // block index, first two words of the counter
+  uint32_t block[4]; // current output block
+  int pos; // position in the output block
+  uint32_t mirrored; // xor mask applied to every output, all ones when mirrored
+  void gen_block(); // encrypt the next counter into block
+  void gen_blocks(uint32_t *words); // encrypt the next BLOCKS_PER_BATCH counters into words, block by block
+};
+
+/** gen_block runs the ten Philox rounds on counter (blockNum, stream, 0) and advances blockNum */
+inline void PhiloxRand::gen_block() {
+  uint32_t c0 = (uint32_t) blockNum, c1 = (uint32_t) (blockNum >> 32), c2 = stream, c3 = 0;
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int round = 0; round < 10; ++round) {
+    uint64_t p0 = (uint64_t) M0 * c0;
+    uint64_t p1 = (uint64_t) M1 * c2;
+    uint32_t n0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+    uint32_t n2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+    c1 = (uint32_t) p1;
+    c3 = (uint32_t) p0;
+    c0 = n0;
+    c2 = n2;
+    k0 += W0;
+    k1 += W1;
+  }
+  block[0] = c0; block[1] = c1; block[2] = c2; block[3] = c3;
+  ++blockNum;
+}
+
+/** gen_blocks runs the ten Philox rounds on the counters (blockNum + i, stream, 0) for i < BLOCKS_PER_BATCH, writing block i to
+// words[4 * i .. 4 * i + 3] (mirrored like randInt32), and advances blockNum past them. With AVX2 the eight counters are held
+// in the eight 32 bit lanes of a register, the 32x32->64 bit products taken on the even and odd lanes separately; otherwise
+// the scalar fallback encrypts the counters one after another, as gen_block does (SSE2 has no cheaper 64 bit products) */
+inline void PhiloxRand::gen_blocks(uint32_t *words) {
+  uint32_t c0[BLOCKS_PER_BATCH], c1[BLOCKS_PER_BATCH], c2[BLOCKS_PER_BATCH], c3[BLOCKS_PER_BATCH];
+  for (int i = 0; i < BLOCKS_PER_BATCH; ++i) {
+    c0[i] = (uint32_t) (blockNum + i);
+    c1[i] = (uint32_t) ((blockNum + i) >> 32);
+    c2[i] = stream;
+    c3[i] = 0;
+  }
+  uint32_t k0 = key[0], k1 = key[1];
+#if defined(__AVX2__)
+  __m256i v0 = _mm256_loadu_si256((const __m256i *) c0), v1 = _mm256_loadu_si256((const __m256i *) c1);
+  __m256i v2 = _mm256_loadu_si256((const __m256i *) c2), v3 = _mm256_setzero_si256();
+  const __m256i m0 = _mm256_set1_epi32((int) M0), m1 = _mm256_set1_epi32((int) M1);
+  for (int round = 0; round < 10; ++round) {
+    __m256i p0Even = _mm256_mul_epu32(v0, m0), p0Odd = _mm256_mul_epu32(_mm256_srli_epi64(v0, 32), m0);
+    __m256i p1Even = _mm256_mul_epu32(v2, m1), p1Odd = _mm256_mul_epu32(_mm256_srli_epi64(v2, 32), m1);
+    __m256i hi0 = _mm256_blend_epi32(_mm256_srli_epi64(p0Even, 32), p0Odd, 0xAA);
+    __m256i lo0 = _mm256_blend_epi32(p0Even, _mm256_slli_epi64(p0Odd, 32), 0xAA);
+    __m256i hi1 = _mm256_blend_epi32(_mm256_srli_epi64(p1Even, 32), p1Odd, 0xAA);
+    __m256i lo1 = _mm256_blend_epi32(p1Even, _mm256_slli_epi64(p1Odd, 32), 0xAA);
+    __m256i n0 = _mm256_xor_si256(_mm256_xor_si256(hi1, v1), _mm256_set1_epi32((int) k0));
+    __m256i n2 = _mm256_xor_si256(_mm256_xor_si256(hi0, v3), _mm256_set1_epi32((int) k1));
+    v1 = lo1;
+    v3 = lo0;
+    v0 = n0;
+    v2 = n2;
+    k0 += W0;
+    k1 += W1;
+  }
+  _mm256_storeu_si256((__m256i *) c0, v0); _mm256_storeu_si256((__m256i *) c1, v1);
+  _mm256_storeu_si256((__m256i *) c2, v2); _mm256_storeu_si256((__m256i *) c3, v3);
+#else
+  for (int i = 0; i < BLOCKS_PER_BATCH; ++i) {
+    uint32_t r0 = k0, r1 = k1;
+    for (int round = 0; round < 10; ++round) {
+      uint64_t p0 = (uint64_t) M0 * c0[i];
+      uint64_t p1 = (uint64_t) M1 * c2[i];
+      uint32_t n0 = (uint32_t) (p1 >> 32) ^ c1[i] ^ r0;
+      uint32_t n2 = (uint32_t) (p0 >> 32) ^ c3[i] ^ r1;
+      c1[i] = (uint32_t) p1;
+      c3[i] = (uint32_t) p0;
+      c0[i] = n0;
+      c2[i] = n2;
+      r0 += W0;
+      r1 += W1;
+    }
+  }
+#endif
+  for (int i = 0; i < BLOCKS_PER_BATCH; ++i) {
+    words[4 * i] = c0[i] ^ mirrored;
+    words[4 * i + 1] = c1[i] ^ mirrored;
+    words[4 * i + 2] = c2[i] ^ mirrored;
+    words[4 * i + 3] = c3[i] ^ mirrored;
+  }
+  blockNum += BLOCKS_PER_BATCH;
+}
+
+/** fillUniforms uses up the current block, then converts whole batches of blocks from gen_blocks, and leaves the last
+// partial batch to operator() so the generator ends exactly where n calls to operator() would have left it */
+inline void PhiloxRand::fillUniforms(double *uniforms, int n) {
+  int i = 0;
+  while (i < n && pos < 4) {
+    uniforms[i++] = (*this)();
+  }
+  uint32_t words[4 * BLOCKS_PER_BATCH];
+  for (; i + 4 * BLOCKS_PER_BATCH <= n; i += 4 * BLOCKS_PER_BATCH) {
+    gen_blocks(words);
+    for (int j = 0; j < 4 * BLOCKS_PER_BATCH; ++j) { // as a signed int shifted back by 2^31, which converts with SIMD
+      uniforms[i + j] = ((int32_t) (words[j] ^ 0x80000000u) + 2147483648.) * (1. / 4294967296.);
+    }
+  }
+  while (i < n) {
+    uniforms[i++] = (*this)();
+  }
+}
+
+#endif // PHILOX_H